@@ -20,10 +20,13 @@
 #include "ig_data.h"
 #include "logger.h"
 #include <stdio.h>
+#include <string.h>
 
-static struct ig_attribute *ig_attribute_new (const char *value, bool constant);
-static inline void          ig_attribute_free (struct ig_attribute *attr);
-static void                 ig_attribute_free_gpointer (gpointer attr);
+static struct ig_attribute *ig_attribute_store_lookup (struct ig_attribute_store *store, unsigned int key, unsigned int *pos);
+static struct ig_attribute *ig_attribute_store_insert (struct ig_attribute_store *store, struct ig_arena *arena, unsigned int key, unsigned int pos);
+static void                 ig_attribute_store_free   (struct ig_attribute_store *store, struct ig_arena *arena);
+static GQueue              *ig_obj_queue_new          (struct ig_object *obj);
+static int                  ig_module_local_name_rank (struct ig_object *local);
 static const char          *ig_port_dir_name (enum ig_port_dir dir);
 
 #define IG_OBJECT_CHILD_QUEUE_UNREF_AND_FREE(PARENTPTR, QUEUE, CHILDTYPE, CHILDTOPARENT) do { \
@@ -33,10 +36,17 @@ static const char          *ig_port_dir_name (enum ig_port_dir dir);
                 if (child->CHILDTOPARENT == PARENTPTR) child->CHILDTOPARENT = NULL; \
                 ig_obj_unref (IG_OBJECT (child)); \
             } \
-            g_queue_free (PARENTPTR->QUEUE); \
+            if (IG_OBJECT (PARENTPTR)->arena == NULL) g_queue_free (PARENTPTR->QUEUE); \
         } \
 } while (false)
 
+/* allocate/free data struct of object - from arena if available */
+#define IG_OBJECT_STRUCT_NEW(ARENA, TYPE) \
+    ((ARENA) != NULL ? (TYPE *)ig_arena_alloc ((ARENA), sizeof (TYPE)) : g_slice_new (TYPE))
+#define IG_OBJECT_STRUCT_FREE(TYPE, PTR) do { \
+        if (IG_OBJECT (PTR)->arena == NULL) g_slice_free (TYPE, PTR); \
+} while (false)
+
 
 /*******************************************************
  * memory management debugging
@@ -52,39 +62,279 @@ static int ig_mman_cnt_objects    = 0;
 #endif
 
 /*******************************************************
- * object data
+ * arena
  *******************************************************/
 
-static struct ig_attribute *ig_attribute_new (const char *value, bool constant)
+#define IG_ARENA_DEFAULT_BLOCK_SIZE (64 * 1024)
+#define IG_ARENA_ALIGN              (2 * sizeof (void *))
+
+struct ig_arena *ig_arena_new (gsize block_size)
 {
-    struct ig_attribute *result = g_slice_new (struct ig_attribute);
+    struct ig_arena *arena = g_slice_new (struct ig_arena);
 
-#ifdef DEBUG_IG_MMAN
-    log_debug ("MManC", "memory management: created attribute - current total: %d", ++ig_mman_cnt_attributes);
-#endif
+    arena->blocks     = NULL;
+    arena->pos        = NULL;
+    arena->left       = 0;
+    arena->block_size = (block_size == 0 ? IG_ARENA_DEFAULT_BLOCK_SIZE : block_size);
+    arena->destroy    = NULL;
+
+    return arena;
+}
+
+gpointer ig_arena_alloc (struct ig_arena *arena, gsize size)
+{
+    size = (size + IG_ARENA_ALIGN - 1) & ~(IG_ARENA_ALIGN - 1);
+
+    if (size > arena->left) {
+        if (size > arena->block_size / 4) {
+            /* large allocation: separate block, keep current block */
+            char *block = g_malloc (size);
+            if (arena->blocks == NULL) {
+                arena->blocks = g_slist_prepend (arena->blocks, block);
+            } else {
+                arena->blocks->next = g_slist_prepend (arena->blocks->next, block);
+            }
+            return block;
+        }
 
-    result->constant = constant;
-    result->value    = value;
+        char *block = g_malloc (arena->block_size);
+        arena->blocks = g_slist_prepend (arena->blocks, block);
+        arena->pos    = block;
+        arena->left   = arena->block_size;
+    }
+
+    gpointer result = arena->pos;
+    arena->pos  += size;
+    arena->left -= size;
 
     return result;
 }
 
-static inline void ig_attribute_free (struct ig_attribute *attr)
+void ig_arena_clear (struct ig_arena *arena)
+{
+    if (arena == NULL) return;
+
+    /* list links and entries are arena memory */
+    for (GSList *li = arena->destroy; li != NULL; li = li->next) {
+        struct ig_arena_destroy *d = (struct ig_arena_destroy *)li->data;
+        d->func (d->data);
+    }
+
+    g_slist_free_full (arena->blocks, g_free);
+
+    arena->blocks  = NULL;
+    arena->pos     = NULL;
+    arena->left    = 0;
+    arena->destroy = NULL;
+}
+
+void ig_arena_add_destroy (struct ig_arena *arena, GDestroyNotify func, gpointer data)
+{
+    if (arena == NULL) return;
+    if (func == NULL) return;
+
+    struct ig_arena_destroy *d    = ig_arena_alloc (arena, sizeof (struct ig_arena_destroy));
+    GSList                  *link = ig_arena_alloc (arena, sizeof (GSList));
+
+    d->func = func;
+    d->data = data;
+
+    link->data     = d;
+    link->next     = arena->destroy;
+    arena->destroy = link;
+}
+
+void ig_arena_free (struct ig_arena *arena)
+{
+    if (arena == NULL) return;
+
+    ig_arena_clear (arena);
+    g_slice_free (struct ig_arena, arena);
+}
+
+/*******************************************************
+ * attribute keys
+ *******************************************************/
+
+/* names of predefined keys - order as in enum ig_attr_key */
+static const char *ig_attr_key_predefined_names[IG_AK_PREDEFINED_COUNT] = {
+    [IG_AK_INVALID]    = NULL,
+    [IG_AK_TYPE]       = "type",
+    [IG_AK_ID]         = "id",
+    [IG_AK_NAME]       = "name",
+    [IG_AK_PARENT]     = "parent",
+    [IG_AK_DIRECTION]  = "direction",
+    [IG_AK_VALUE]      = "value",
+    [IG_AK_LOCAL]      = "local",
+    [IG_AK_CODE]       = "code",
+    [IG_AK_MODULE]     = "module",
+    [IG_AK_ILM]        = "ilm",
+    [IG_AK_RESOURCE]   = "resource",
+    [IG_AK_CONNECTION] = "connection",
+    [IG_AK_INVERT]     = "invert",
+    [IG_AK_SIZE]       = "size",
+    [IG_AK_SIGNAL]     = "signal",
+    [IG_AK_NET]        = "net",
+    [IG_AK_NETID]      = "netid",
+    [IG_AK_PARAMETER]  = "parameter",
+    [IG_AK_GENERIC]    = "generic",
+    [IG_AK_GENERICID]  = "genericid",
+};
+
+/* interned keys - shared by all objects, never freed */
+static GHashTable *ig_attr_key_ids   = NULL; /* name -> key */
+static GPtrArray  *ig_attr_key_names = NULL; /* key  -> name */
+
+static void ig_attr_key_table_init ()
+{
+    if (ig_attr_key_ids != NULL) return;
+
+    ig_attr_key_ids   = g_hash_table_new (g_str_hash, g_str_equal);
+    ig_attr_key_names = g_ptr_array_new ();
+
+    for (unsigned int i = 0; i < IG_AK_PREDEFINED_COUNT; i++) {
+        const char *name = ig_attr_key_predefined_names[i];
+        g_ptr_array_add (ig_attr_key_names, (gpointer)name);
+        if (name != NULL) {
+            g_hash_table_insert (ig_attr_key_ids, (gpointer)name, GUINT_TO_POINTER (i));
+        }
+    }
+}
+
+unsigned int ig_attr_key_intern (const char *name)
 {
-    if (attr == NULL) return;
+    if (name == NULL) return IG_AK_INVALID;
 
-    g_slice_free (struct ig_attribute, attr);
+    unsigned int key = ig_attr_key_lookup (name);
+    if (key != IG_AK_INVALID) return key;
+
+    char *local_name = g_strdup (name);
+    key = ig_attr_key_names->len;
+
+    g_ptr_array_add (ig_attr_key_names, local_name);
+    g_hash_table_insert (ig_attr_key_ids, local_name, GUINT_TO_POINTER (key));
+
+    return key;
+}
+
+unsigned int ig_attr_key_lookup (const char *name)
+{
+    if (name == NULL) return IG_AK_INVALID;
+
+    ig_attr_key_table_init ();
+
+    return GPOINTER_TO_UINT (g_hash_table_lookup (ig_attr_key_ids, name));
+}
+
+const char *ig_attr_key_name (unsigned int key)
+{
+    ig_attr_key_table_init ();
+
+    if (key >= ig_attr_key_names->len) return NULL;
+
+    return (const char *)g_ptr_array_index (ig_attr_key_names, key);
+}
+
+/*******************************************************
+ * attribute storage
+ *******************************************************/
+
+/* lookup attribute by key - returns attribute or NULL, *pos is set to the insert position if not found */
+static struct ig_attribute *ig_attribute_store_lookup (struct ig_attribute_store *store, unsigned int key, unsigned int *pos)
+{
+    if (store->index != NULL) {
+        gpointer idx = g_hash_table_lookup (store->index, GUINT_TO_POINTER (key));
+        *pos = store->count;
+        if (idx == NULL) return NULL;
+        return &store->data[GPOINTER_TO_UINT (idx) - 1];
+    }
+
+    unsigned int lo = 0;
+    unsigned int hi = store->count;
+    while (lo < hi) {
+        unsigned int mid = lo + (hi - lo) / 2;
+        unsigned int k   = store->data[mid].key;
+
+        if (k == key) {
+            *pos = mid;
+            return &store->data[mid];
+        }
+        if (key < k) {
+            hi = mid;
+        } else {
+            lo = mid + 1;
+        }
+    }
+
+    *pos = lo;
+    return NULL;
+}
+
+/* insert new attribute at given position */
+static struct ig_attribute *ig_attribute_store_insert (struct ig_attribute_store *store, struct ig_arena *arena, unsigned int key, unsigned int pos)
+{
+    if (store->count == store->size) {
+        store->size = (store->size == 0 ? 4 : 2 * store->size);
+        if (arena == NULL) {
+            store->data = g_renew (struct ig_attribute, store->data, store->size);
+        } else {
+            struct ig_attribute *data = ig_arena_alloc (arena, store->size * sizeof (struct ig_attribute));
+            if (store->count > 0) {
+                memcpy (data, store->data, store->count * sizeof (struct ig_attribute));
+            }
+            store->data = data;
+        }
+    }
+
+    if (pos < store->count) {
+        memmove (&store->data[pos+1], &store->data[pos], (store->count - pos) * sizeof (struct ig_attribute));
+    }
+    store->count++;
 
 #ifdef DEBUG_IG_MMAN
-    log_debug ("MManC", "memory management: freed attribute - current total: %d", --ig_mman_cnt_attributes);
+    log_debug ("MManC", "memory management: created attribute - current total: %d", ++ig_mman_cnt_attributes);
 #endif
+
+    struct ig_attribute *result = &store->data[pos];
+    result->key = key;
+
+    if (store->index != NULL) {
+        g_hash_table_insert (store->index, GUINT_TO_POINTER (key), GUINT_TO_POINTER (pos + 1));
+    } else if ((store->count > IG_ATTR_INLINE_MAX) && (arena == NULL)) {
+        /* from now on: append-only array + key index */
+        store->index = g_hash_table_new (g_direct_hash, g_direct_equal);
+        for (unsigned int i = 0; i < store->count; i++) {
+            g_hash_table_insert (store->index, GUINT_TO_POINTER (store->data[i].key), GUINT_TO_POINTER (i + 1));
+        }
+    }
+
+    return result;
 }
 
-static void ig_attribute_free_gpointer (gpointer attr)
+static void ig_attribute_store_free (struct ig_attribute_store *store, struct ig_arena *arena)
 {
-    ig_attribute_free ((struct ig_attribute *)attr);
+#ifdef DEBUG_IG_MMAN
+    ig_mman_cnt_attributes -= store->count;
+    log_debug ("MManC", "memory management: freed %d attributes - current total: %d", store->count, ig_mman_cnt_attributes);
+#endif
+
+    if (store->index != NULL) {
+        g_hash_table_destroy (store->index);
+    }
+    if (arena == NULL) {
+        g_free (store->data);
+    }
+
+    store->data  = NULL;
+    store->count = 0;
+    store->size  = 0;
+    store->index = NULL;
 }
 
+/*******************************************************
+ * object data
+ *******************************************************/
+
 const char *ig_obj_type_name (enum ig_object_type type)
 {
     switch (type) {
@@ -106,7 +356,7 @@ const char *ig_obj_type_name (enum ig_object_type type)
     return "UNKNOWN";
 }
 
-void ig_obj_init (enum ig_object_type type, const char *name, struct ig_object *plist[], struct ig_object *obj, GStringChunk *storage)
+void ig_obj_init (enum ig_object_type type, const char *name, struct ig_object *plist[], struct ig_object *obj, GStringChunk *storage, struct ig_arena *arena)
 {
     if (name == NULL) return;
     if (obj  == NULL) return;
@@ -124,7 +374,7 @@ void ig_obj_init (enum ig_object_type type, const char *name, struct ig_object *
     if (plist != NULL) {
         for (int i = 0; plist[i] != NULL; i++) {
             struct ig_object *ip = plist[i];
-            s_id   = g_string_append (s_id, ig_obj_attr_get (ip, "name"));
+            s_id   = g_string_append (s_id, ip->name);
             s_id   = g_string_append (s_id, "#");
             parent = ip;
         }
@@ -135,7 +385,9 @@ void ig_obj_init (enum ig_object_type type, const char *name, struct ig_object *
     log_debug ("DONew", "Creating object of type %s, name %s, parent %s", ig_obj_type_name (type), name, (parent != NULL ? parent->id : "<none>"));
 
     obj->type     = type;
+    obj->seq      = 0;
     obj->refcount = 0;
+    obj->arena    = arena;
 
     if (storage == NULL) {
         obj->string_storage      = g_string_chunk_new (256);
@@ -145,26 +397,33 @@ void ig_obj_init (enum ig_object_type type, const char *name, struct ig_object *
         obj->string_storage_free = false;
     }
 
-    obj->attributes = g_hash_table_new_full (g_str_hash, g_str_equal, NULL, ig_attribute_free_gpointer);
+    obj->attributes.data  = NULL;
+    obj->attributes.count = 0;
+    obj->attributes.size  = 0;
+    obj->attributes.index = NULL;
+    obj->child_index      = NULL;
 
-    ig_obj_attr_set (obj, "type", ig_obj_type_name (type), true);
-    ig_obj_attr_set (obj, "id",   s_id->str,               true);
-    ig_obj_attr_set (obj, "name", name,                    true);
+    ig_obj_attr_set_by_key (obj, IG_AK_TYPE, ig_obj_type_name (type), true);
+    ig_obj_attr_set_by_key (obj, IG_AK_ID,   s_id->str,               true);
+    ig_obj_attr_set_by_key (obj, IG_AK_NAME, name,                    true);
     if (parent != NULL) {
-        ig_obj_attr_set (obj, "parent", parent->id, true);
+        ig_obj_attr_set_by_key (obj, IG_AK_PARENT, parent->id, true);
     }
 
     g_string_free (s_id, true);
 
-    obj->id   = ig_obj_attr_get (obj, "id");
-    obj->name = ig_obj_attr_get (obj, "name");
+    obj->id   = ig_obj_attr_get_by_key (obj, IG_AK_ID);
+    obj->name = ig_obj_attr_get_by_key (obj, IG_AK_NAME);
 }
 
 void ig_obj_free (struct ig_object *obj)
 {
     if (obj == NULL) return;
 
-    g_hash_table_destroy (obj->attributes);
+    ig_attribute_store_free (&obj->attributes, obj->arena);
+    if ((obj->child_index != NULL) && (obj->arena == NULL)) {
+        g_hash_table_destroy (obj->child_index);
+    }
 
     if (obj->string_storage_free) {
         g_string_chunk_free (obj->string_storage);
@@ -200,6 +459,7 @@ void ig_obj_free_full (struct ig_object *obj)
 void ig_obj_ref (struct ig_object *obj)
 {
     if (obj == NULL) return;
+    if (obj->arena != NULL) return;
 
     obj->refcount++;
 }
@@ -207,6 +467,7 @@ void ig_obj_ref (struct ig_object *obj)
 void ig_obj_unref (struct ig_object *obj)
 {
     if (obj == NULL) return;
+    if (obj->arena != NULL) return;
 
     obj->refcount--;
     if (obj->refcount <= 0) {
@@ -215,41 +476,143 @@ void ig_obj_unref (struct ig_object *obj)
     }
 }
 
-bool ig_obj_attr_set (struct ig_object *obj, const char *name, const char *value, bool constant)
+void ig_obj_queue_push_tail (struct ig_object *obj, GQueue *queue, gpointer data)
+{
+    if (obj == NULL) return;
+    if (queue == NULL) return;
+
+    if (obj->arena == NULL) {
+        g_queue_push_tail (queue, data);
+    } else {
+        GList *link = ig_arena_alloc (obj->arena, sizeof (GList));
+
+        link->data = data;
+        link->next = NULL;
+        link->prev = NULL;
+        g_queue_push_tail_link (queue, link);
+    }
+
+    if (obj->child_index != NULL) {
+        GHashTable *index = g_hash_table_lookup (obj->child_index, queue);
+        if (index != NULL) {
+            struct ig_object *child = PTR_TO_IG_OBJECT (data);
+            if (!g_hash_table_contains (index, child->name)) {
+                g_hash_table_insert (index, (gpointer)child->name, child);
+            }
+        }
+    }
+}
+
+struct ig_object *ig_obj_child_by_name (struct ig_object *obj, GQueue *queue, const char *name)
+{
+    if (obj == NULL) return NULL;
+    if (queue == NULL) return NULL;
+    if (name == NULL) return NULL;
+
+    if (queue->length < IG_OBJ_CHILD_INDEX_MIN) {
+        for (GList *li = queue->head; li != NULL; li = li->next) {
+            struct ig_object *child = PTR_TO_IG_OBJECT (li->data);
+            if (strcmp (child->name, name) == 0) return child;
+        }
+        return NULL;
+    }
+
+    GHashTable *index = NULL;
+
+    if (obj->child_index == NULL) {
+        obj->child_index = g_hash_table_new_full (g_direct_hash, g_direct_equal, NULL, (GDestroyNotify)g_hash_table_destroy);
+        if (obj->arena != NULL) {
+            ig_arena_add_destroy (obj->arena, (GDestroyNotify)g_hash_table_destroy, obj->child_index);
+        }
+    } else {
+        index = g_hash_table_lookup (obj->child_index, queue);
+    }
+
+    if (index == NULL) {
+        index = g_hash_table_new (g_str_hash, g_str_equal);
+        for (GList *li = queue->head; li != NULL; li = li->next) {
+            struct ig_object *child = PTR_TO_IG_OBJECT (li->data);
+            if (!g_hash_table_contains (index, child->name)) {
+                g_hash_table_insert (index, (gpointer)child->name, child);
+            }
+        }
+        g_hash_table_insert (obj->child_index, queue, index);
+    }
+
+    return PTR_TO_IG_OBJECT (g_hash_table_lookup (index, name));
+}
+
+static GQueue *ig_obj_queue_new (struct ig_object *obj)
+{
+    if (obj->arena == NULL) return g_queue_new ();
+
+    GQueue *queue = ig_arena_alloc (obj->arena, sizeof (GQueue));
+    g_queue_init (queue);
+
+    return queue;
+}
+
+bool ig_obj_attr_set_by_key (struct ig_object *obj, unsigned int key, const char *value, bool constant)
 {
     if (obj == NULL) return false;
-    if (name == NULL) return false;
+    if (key == IG_AK_INVALID) return false;
     if (value == NULL) return false;
 
-    struct ig_attribute *old_val = (struct ig_attribute *)g_hash_table_lookup (obj->attributes, name);
+    unsigned int         pos  = 0;
+    struct ig_attribute *attr = ig_attribute_store_lookup (&obj->attributes, key, &pos);
 
-    if ((old_val != NULL) && (old_val->constant)) return false;
+    if ((attr != NULL) && (attr->constant)) return false;
 
-    char                *local_name         = g_string_chunk_insert_const (obj->string_storage, name);
-    char                *local_value_string = g_string_chunk_insert_const (obj->string_storage, value);
-    struct ig_attribute *value_entry        = ig_attribute_new (local_value_string, constant);
+    if (attr == NULL) {
+        attr = ig_attribute_store_insert (&obj->attributes, obj->arena, key, pos);
+    }
 
-    g_hash_table_insert (obj->attributes, local_name, value_entry);
+    attr->value    = g_string_chunk_insert_const (obj->string_storage, value);
+    attr->constant = constant;
 
     return true;
 }
 
+const char *ig_obj_attr_get_by_key (struct ig_object *obj, unsigned int key)
+{
+    if (obj == NULL) return NULL;
+    if (key == IG_AK_INVALID) return NULL;
+
+    unsigned int         pos  = 0;
+    struct ig_attribute *attr = ig_attribute_store_lookup (&obj->attributes, key, &pos);
+
+    if (attr == NULL) return NULL;
+    return attr->value;
+}
+
+bool ig_obj_attr_set (struct ig_object *obj, const char *name, const char *value, bool constant)
+{
+    if (obj == NULL) return false;
+    if (name == NULL) return false;
+    if (value == NULL) return false;
+
+    return ig_obj_attr_set_by_key (obj, ig_attr_key_intern (name), value, constant);
+}
+
 const char *ig_obj_attr_get (struct ig_object *obj, const char *name)
 {
     if (obj == NULL) return NULL;
     if (name == NULL) return NULL;
 
-    struct ig_attribute *value = (struct ig_attribute *)g_hash_table_lookup (obj->attributes, name);
-
-    if (value == NULL) return NULL;
-    return value->value;
+    return ig_obj_attr_get_by_key (obj, ig_attr_key_lookup (name));
 }
 
 GList *ig_obj_attr_get_keys (struct ig_object *obj)
 {
     if (obj == NULL) return NULL;
 
-    return g_hash_table_get_keys (obj->attributes);
+    GList *result = NULL;
+
+    for (unsigned int i = obj->attributes.count; i > 0; i--) {
+        result = g_list_prepend (result, (gpointer)ig_attr_key_name (obj->attributes.data[i-1].key));
+    }
+
+    return result;
 }
 
 bool ig_obj_attr_set_from_gslist (struct ig_object *obj, GList *list)
@@ -292,17 +655,17 @@ static const char *ig_port_dir_name (enum ig_port_dir dir)
  * port data
  *******************************************************/
 
-struct ig_port *ig_port_new (const char *name, enum ig_port_dir dir, struct ig_module *parent, GStringChunk *storage)
+struct ig_port *ig_port_new (const char *name, enum ig_port_dir dir, struct ig_module *parent, GStringChunk *storage, struct ig_arena *arena)
 {
     if (name == NULL) return NULL;
     if (parent == NULL) return NULL;
 
-    struct ig_port   *port     = g_slice_new (struct ig_port);
+    struct ig_port   *port     = IG_OBJECT_STRUCT_NEW (arena, struct ig_port);
     struct ig_object *plist[2] = {IG_OBJECT (parent), NULL};
 
-    ig_obj_init (IG_OBJ_PORT, name, plist, IG_OBJECT (port), storage);
+    ig_obj_init (IG_OBJ_PORT, name, plist, IG_OBJECT (port), storage, arena);
 
-    ig_obj_attr_set (IG_OBJECT (port), "direction", ig_port_dir_name (dir), true);
+    ig_obj_attr_set_by_key (IG_OBJECT (port), IG_AK_DIRECTION, ig_port_dir_name (dir), true);
 
     port->dir    = dir;
     port->parent = parent;
@@ -316,28 +679,28 @@ void ig_port_free (struct ig_port *port)
     if (port == NULL) return;
 
     ig_obj_free (IG_OBJECT (port));
-    g_slice_free (struct ig_port, port);
+    IG_OBJECT_STRUCT_FREE (struct ig_port, port);
 }
 
 /*******************************************************
  * parameter data
  *******************************************************/
 
-struct ig_param *ig_param_new (const char *name, const char *value, bool local, struct ig_module *parent, GStringChunk *storage)
+struct ig_param *ig_param_new (const char *name, const char *value, bool local, struct ig_module *parent, GStringChunk *storage, struct ig_arena *arena)
 {
     if (name == NULL) return NULL;
     if (parent == NULL) return NULL;
     if (value == NULL) return NULL;
 
-    struct ig_param  *param    = g_slice_new (struct ig_param);
+    struct ig_param  *param    = IG_OBJECT_STRUCT_NEW (arena, struct ig_param);
     struct ig_object *plist[2] = {IG_OBJECT (parent), NULL};
 
-    ig_obj_init (IG_OBJ_PARAMETER, name, plist, IG_OBJECT (param), storage);
+    ig_obj_init (IG_OBJ_PARAMETER, name, plist, IG_OBJECT (param), storage, arena);
 
-    ig_obj_attr_set (IG_OBJECT (param), "value",  value, true);
-    ig_obj_attr_set (IG_OBJECT (param), "local",  (local ? "true" : "false"), true);
+    ig_obj_attr_set_by_key (IG_OBJECT (param), IG_AK_VALUE, value,                      true);
+    ig_obj_attr_set_by_key (IG_OBJECT (param), IG_AK_LOCAL, (local ? "true" : "false"), true);
 
-    param->value   = ig_obj_attr_get (IG_OBJECT (param), "value");
+    param->value   = ig_obj_attr_get_by_key (IG_OBJECT (param), IG_AK_VALUE);
     param->local   = local;
     param->parent  = parent;
     param->generic = NULL;
@@ -350,7 +713,7 @@ void ig_param_free (struct ig_param *param)
     if (param == NULL) return;
 
     ig_obj_free (IG_OBJECT (param));
-    g_slice_free (struct ig_param, param);
+    IG_OBJECT_STRUCT_FREE (struct ig_param, param);
 }
 
 
@@ -358,15 +721,15 @@ void ig_param_free (struct ig_param *param)
  * declaration data
  *******************************************************/
 
-struct ig_decl *ig_decl_new (const char *name, struct ig_module *parent, GStringChunk *storage)
+struct ig_decl *ig_decl_new (const char *name, struct ig_module *parent, GStringChunk *storage, struct ig_arena *arena)
 {
     if (name == NULL) return NULL;
     if (parent == NULL) return NULL;
 
-    struct ig_decl   *decl     = g_slice_new (struct ig_decl);
+    struct ig_decl   *decl     = IG_OBJECT_STRUCT_NEW (arena, struct ig_decl);
     struct ig_object *plist[2] = {IG_OBJECT (parent), NULL};
 
-    ig_obj_init (IG_OBJ_DECLARATION, name, plist, IG_OBJECT (decl), storage);
+    ig_obj_init (IG_OBJ_DECLARATION, name, plist, IG_OBJECT (decl), storage, arena);
 
     decl->parent             = parent;
     decl->net                = NULL;
@@ -379,14 +742,14 @@ void ig_decl_free (struct ig_decl *decl)
     if (decl == NULL) return;
 
     ig_obj_free (IG_OBJECT (decl));
-    g_slice_free (struct ig_decl, decl);
+    IG_OBJECT_STRUCT_FREE (struct ig_decl, decl);
 }
 
 /*******************************************************
  * codesection data
  *******************************************************/
 
-struct ig_code *ig_code_new (const char *name, const char *codesection, struct ig_module *parent, GStringChunk *storage)
+struct ig_code *ig_code_new (const char *name, const char *codesection, struct ig_module *parent, GStringChunk *storage, struct ig_arena *arena)
 {
     if (codesection == NULL) return NULL;
     if (parent == NULL) return NULL;
@@ -403,14 +766,14 @@ struct ig_code *ig_code_new (const char *name, const char *codesection, struct i
         s_name = g_string_append (s_name, name);
     }
 
-    struct ig_code   *code     = g_slice_new (struct ig_code);
+    struct ig_code   *code     = IG_OBJECT_STRUCT_NEW (arena, struct ig_code);
     struct ig_object *plist[2] = {IG_OBJECT (parent), NULL};
 
-    ig_obj_init (IG_OBJ_CODESECTION, s_name->str, plist, IG_OBJECT (code), storage);
+    ig_obj_init (IG_OBJ_CODESECTION, s_name->str, plist, IG_OBJECT (code), storage, arena);
 
-    ig_obj_attr_set (IG_OBJECT (code), "code",   codesection,        true);
+    ig_obj_attr_set_by_key (IG_OBJECT (code), IG_AK_CODE, codesection, true);
 
-    code->code   = ig_obj_attr_get (IG_OBJECT (code), "code");
+    code->code   = ig_obj_attr_get_by_key (IG_OBJECT (code), IG_AK_CODE);
     code->parent = parent;
 
     g_string_free (s_name, true);
@@ -423,22 +786,22 @@ void ig_code_free (struct ig_code *code)
     if (code == NULL) return;
 
     ig_obj_free (IG_OBJECT (code));
-    g_slice_free (struct ig_code, code);
+    IG_OBJECT_STRUCT_FREE (struct ig_code, code);
 }
 
 /*******************************************************
  * regfile data
  *******************************************************/
 
-struct ig_rf_reg *ig_rf_reg_new (const char *name, struct ig_rf_entry *parent, GStringChunk *storage)
+struct ig_rf_reg *ig_rf_reg_new (const char *name, struct ig_rf_entry *parent, GStringChunk *storage, struct ig_arena *arena)
 {
     if (name == NULL) return NULL;
     if (parent == NULL) return NULL;
 
-    struct ig_rf_reg *reg      = g_slice_new (struct ig_rf_reg);
+    struct ig_rf_reg *reg      = IG_OBJECT_STRUCT_NEW (arena, struct ig_rf_reg);
     struct ig_object *plist[4] = {IG_OBJECT (parent->parent->parent), IG_OBJECT (parent->parent), IG_OBJECT (parent), NULL};
 
-    ig_obj_init (IG_OBJ_REGFILE_REG, name, plist, IG_OBJECT (reg), storage);
+    ig_obj_init (IG_OBJ_REGFILE_REG, name, plist, IG_OBJECT (reg), storage, arena);
 
     reg->parent = parent;
 
@@ -450,21 +813,21 @@ void ig_rf_reg_free (struct ig_rf_reg *reg)
     if (reg == NULL) return;
 
     ig_obj_free (IG_OBJECT (reg));
-    g_slice_free (struct ig_rf_reg, reg);
+    IG_OBJECT_STRUCT_FREE (struct ig_rf_reg, reg);
 }
 
-struct ig_rf_entry *ig_rf_entry_new (const char *name, struct ig_rf_regfile *parent, GStringChunk *storage)
+struct ig_rf_entry *ig_rf_entry_new (const char *name, struct ig_rf_regfile *parent, GStringChunk *storage, struct ig_arena *arena)
 {
     if (name == NULL) return NULL;
     if (parent == NULL) return NULL;
 
-    struct ig_rf_entry *entry    = g_slice_new (struct ig_rf_entry);
+    struct ig_rf_entry *entry    = IG_OBJECT_STRUCT_NEW (arena, struct ig_rf_entry);
     struct ig_object   *plist[3] = {IG_OBJECT (parent->parent), IG_OBJECT (parent), NULL};
 
-    ig_obj_init (IG_OBJ_REGFILE_ENTRY, name, plist, IG_OBJECT (entry), storage);
+    ig_obj_init (IG_OBJ_REGFILE_ENTRY, name, plist, IG_OBJECT (entry), storage, arena);
 
     entry->parent = parent;
-    entry->regs   = g_queue_new ();
+    entry->regs   = ig_obj_queue_new (IG_OBJECT (entry));
 
     return entry;
 }
@@ -477,10 +840,10 @@ void ig_rf_entry_free (struct ig_rf_entry *entry)
 
     IG_OBJECT_CHILD_QUEUE_UNREF_AND_FREE (entry, regs, struct ig_rf_reg, parent);
 
-    g_slice_free (struct ig_rf_entry, entry);
+    IG_OBJECT_STRUCT_FREE (struct ig_rf_entry, entry);
 }
 
-struct ig_rf_regfile *ig_rf_regfile_new (const char *name, struct ig_module *parent, GStringChunk *storage)
+struct ig_rf_regfile *ig_rf_regfile_new (const char *name, struct ig_module *parent, GStringChunk *storage, struct ig_arena *arena)
 {
     if (name == NULL) return NULL;
     if (parent == NULL) return NULL;
@@ -489,15 +852,15 @@ struct ig_rf_regfile *ig_rf_regfile_new (const char *name, struct ig_module *par
         return NULL;
     }
 
-    struct ig_rf_regfile *regfile  = g_slice_new (struct ig_rf_regfile);
+    struct ig_rf_regfile *regfile  = IG_OBJECT_STRUCT_NEW (arena, struct ig_rf_regfile);
     struct ig_object     *plist[2] = {IG_OBJECT (parent), NULL};
 
-    ig_obj_init (IG_OBJ_REGFILE, name, plist, IG_OBJECT (regfile), storage);
+    ig_obj_init (IG_OBJ_REGFILE, name, plist, IG_OBJECT (regfile), storage, arena);
 
-    ig_obj_attr_set (IG_OBJECT (regfile), "module", IG_OBJECT (parent)->id, true);
+    ig_obj_attr_set_by_key (IG_OBJECT (regfile), IG_AK_MODULE, IG_OBJECT (parent)->id, true);
 
     regfile->parent  = parent;
-    regfile->entries = g_queue_new ();
+    regfile->entries = ig_obj_queue_new (IG_OBJECT (regfile));
 
     return regfile;
 }
@@ -510,32 +873,36 @@ void ig_rf_regfile_free (struct ig_rf_regfile *regfile)
 
     IG_OBJECT_CHILD_QUEUE_UNREF_AND_FREE (regfile, entries, struct ig_rf_entry, parent);
 
-    g_slice_free (struct ig_rf_regfile, regfile);
+    IG_OBJECT_STRUCT_FREE (struct ig_rf_regfile, regfile);
 }
 
 /*******************************************************
  * module data
  *******************************************************/
 
-struct ig_module *ig_module_new (const char *name, bool ilm, bool resource, GStringChunk *storage)
+struct ig_module *ig_module_new (const char *name, bool ilm, bool resource, GStringChunk *storage, struct ig_arena *arena)
 {
     if (name == NULL) return NULL;
     log_debug ("DMNew", "Generating module %s", name);
 
-    struct ig_module *module   = g_slice_new (struct ig_module);
+    struct ig_module *module   = IG_OBJECT_STRUCT_NEW (arena, struct ig_module);
     struct ig_object *plist[1] = {NULL};
 
-    ig_obj_init (IG_OBJ_MODULE, name, plist, IG_OBJECT (module), storage);
+    ig_obj_init (IG_OBJ_MODULE, name, plist, IG_OBJECT (module), storage, arena);
 
-    ig_obj_attr_set (IG_OBJECT (module), "ilm",      (ilm      ? "true" : "false"), true);
-    ig_obj_attr_set (IG_OBJECT (module), "resource", (resource ? "true" : "false"), true);
+    ig_obj_attr_set_by_key (IG_OBJECT (module), IG_AK_ILM,      (ilm      ? "true" : "false"), true);
+    ig_obj_attr_set_by_key (IG_OBJECT (module), IG_AK_RESOURCE, (resource ? "true" : "false"), true);
 
     module->ilm      = ilm;
     module->resource = resource;
 
-    module->params        = g_queue_new ();
-    module->ports         = g_queue_new ();
-    module->mod_instances = g_queue_new ();
+    module->params        = ig_obj_queue_new (IG_OBJECT (module));
+    module->ports         = ig_obj_queue_new (IG_OBJECT (module));
+    module->mod_instances = ig_obj_queue_new (IG_OBJECT (module));
+    module->local_names   = g_hash_table_new (g_str_hash, g_str_equal);
+    if (arena != NULL) {
+        ig_arena_add_destroy (arena, (GDestroyNotify)g_hash_table_destroy, module->local_names);
+    }
 
     if (resource) {
         module->decls            = NULL;
@@ -544,11 +911,11 @@ struct ig_module *ig_module_new (const char *name, bool ilm, bool resource, GStr
         module->regfiles         = NULL;
         module->default_instance = NULL;
     } else {
-        module->decls            = g_queue_new ();
-        module->code             = g_queue_new ();
-        module->child_instances  = g_queue_new ();
-        module->regfiles         = g_queue_new ();
-        module->default_instance = ig_instance_new (name, module, NULL, storage);
+        module->decls            = ig_obj_queue_new (IG_OBJECT (module));
+        module->code             = ig_obj_queue_new (IG_OBJECT (module));
+        module->child_instances  = ig_obj_queue_new (IG_OBJECT (module));
+        module->regfiles         = ig_obj_queue_new (IG_OBJECT (module));
+        module->default_instance = ig_instance_new (name, module, NULL, storage, arena);
 
         ig_obj_ref (IG_OBJECT (module->default_instance));
     }
@@ -568,6 +935,10 @@ void ig_module_free (struct ig_module *module)
         }
     }
 
+    if (IG_OBJECT (module)->arena == NULL) {
+        g_hash_table_destroy (module->local_names);
+    }
+
     ig_obj_free (IG_OBJECT (module));
 
     IG_OBJECT_CHILD_QUEUE_UNREF_AND_FREE (module, params,          struct ig_param,      parent);
@@ -578,7 +949,37 @@ void ig_module_free (struct ig_module *module)
     IG_OBJECT_CHILD_QUEUE_UNREF_AND_FREE (module, child_instances, struct ig_instance,   parent);
     IG_OBJECT_CHILD_QUEUE_UNREF_AND_FREE (module, regfiles,        struct ig_rf_regfile, parent);
 
-    g_slice_free (struct ig_module, module);
+    IG_OBJECT_STRUCT_FREE (struct ig_module, module);
+}
+
+static int ig_module_local_name_rank (struct ig_object *local)
+{
+    switch (local->type) {
+        case IG_OBJ_PORT:        return 1;
+        case IG_OBJ_DECLARATION: return 2;
+        case IG_OBJ_PARAMETER:   return 3;
+        default:                 return 0;
+    }
+}
+
+void ig_module_local_name_add (struct ig_module *module, const char *name, struct ig_object *local)
+{
+    if (module == NULL) return;
+    if (name == NULL) return;
+    if (local == NULL) return;
+
+    struct ig_object *existing = PTR_TO_IG_OBJECT (g_hash_table_lookup (module->local_names, name));
+
+    if (existing != NULL) {
+        int rank_new      = ig_module_local_name_rank (local);
+        int rank_existing = ig_module_local_name_rank (existing);
+
+        if (rank_new < rank_existing) return;
+        /* same kind: earlier created object takes precedence */
+        if ((rank_new == rank_existing) && (local->seq < existing->seq)) return;
+    }
+
+    g_hash_table_insert (module->local_names, (gpointer)name, local);
 }
 
 
@@ -586,20 +987,20 @@ void ig_module_free (struct ig_module *module)
  * pin data
  *******************************************************/
 
-struct ig_pin *ig_pin_new (const char *name, const char *connection, struct ig_instance *parent, GStringChunk *storage)
+struct ig_pin *ig_pin_new (const char *name, const char *connection, struct ig_instance *parent, GStringChunk *storage, struct ig_arena *arena)
 {
     if (name == NULL) return NULL;
     if (connection == NULL) return NULL;
     if (parent == NULL) return NULL;
 
-    struct ig_pin    *pin      = g_slice_new (struct ig_pin);
+    struct ig_pin    *pin      = IG_OBJECT_STRUCT_NEW (arena, struct ig_pin);
     struct ig_object *plist[2] = {IG_OBJECT (parent), NULL};
 
-    ig_obj_init (IG_OBJ_PIN, name, plist, IG_OBJECT (pin), storage);
+    ig_obj_init (IG_OBJ_PIN, name, plist, IG_OBJECT (pin), storage, arena);
 
-    ig_obj_attr_set (IG_OBJECT (pin), "connection", connection, true);
+    ig_obj_attr_set_by_key (IG_OBJECT (pin), IG_AK_CONNECTION, connection, true);
 
-    pin->connection = ig_obj_attr_get (IG_OBJECT (pin), "connection");
+    pin->connection = ig_obj_attr_get_by_key (IG_OBJECT (pin), IG_AK_CONNECTION);
     pin->parent     = parent;
     pin->net        = NULL;
 
@@ -611,7 +1012,7 @@ void ig_pin_free (struct ig_pin *pin)
     if (pin == NULL) return;
 
     ig_obj_free (IG_OBJECT (pin));
-    g_slice_free (struct ig_pin, pin);
+    IG_OBJECT_STRUCT_FREE (struct ig_pin, pin);
 }
 
 
@@ -619,20 +1020,20 @@ void ig_pin_free (struct ig_pin *pin)
  * adjustment data
  *******************************************************/
 
-struct ig_adjustment *ig_adjustment_new (const char *name, const char *value, struct ig_instance *parent, GStringChunk *storage)
+struct ig_adjustment *ig_adjustment_new (const char *name, const char *value, struct ig_instance *parent, GStringChunk *storage, struct ig_arena *arena)
 {
     if (name == NULL) return NULL;
     if (parent == NULL) return NULL;
     if (value == NULL) return NULL;
 
-    struct ig_adjustment *adjustment = g_slice_new (struct ig_adjustment);
+    struct ig_adjustment *adjustment = IG_OBJECT_STRUCT_NEW (arena, struct ig_adjustment);
     struct ig_object     *plist[2]   = {IG_OBJECT (parent), NULL};
 
-    ig_obj_init (IG_OBJ_ADJUSTMENT, name, plist, IG_OBJECT (adjustment), storage);
+    ig_obj_init (IG_OBJ_ADJUSTMENT, name, plist, IG_OBJECT (adjustment), storage, arena);
 
-    ig_obj_attr_set (IG_OBJECT (adjustment), "value",  value, true);
+    ig_obj_attr_set_by_key (IG_OBJECT (adjustment), IG_AK_VALUE, value, true);
 
-    adjustment->value   = ig_obj_attr_get (IG_OBJECT (adjustment), "value");
+    adjustment->value   = ig_obj_attr_get_by_key (IG_OBJECT (adjustment), IG_AK_VALUE);
     adjustment->parent  = parent;
     adjustment->generic = NULL;
 
@@ -644,7 +1045,7 @@ void ig_adjustment_free (struct ig_adjustment *adjustment)
     if (adjustment == NULL) return;
 
     ig_obj_free (IG_OBJECT (adjustment));
-    g_slice_free (struct ig_adjustment, adjustment);
+    IG_OBJECT_STRUCT_FREE (struct ig_adjustment, adjustment);
 }
 
 
@@ -652,7 +1053,7 @@ void ig_adjustment_free (struct ig_adjustment *adjustment)
  * instance data
  *******************************************************/
 
-struct ig_instance *ig_instance_new (const char *name, struct ig_module *module, struct ig_module *parent, GStringChunk *storage)
+struct ig_instance *ig_instance_new (const char *name, struct ig_module *module, struct ig_module *parent, GStringChunk *storage, struct ig_arena *arena)
 {
     if (name == NULL) return NULL;
     if (module == NULL) return NULL;
@@ -663,18 +1064,18 @@ struct ig_instance *ig_instance_new (const char *name, struct ig_module *module,
         return NULL;
     }
 
-    struct ig_instance *instance = g_slice_new (struct ig_instance);
+    struct ig_instance *instance = IG_OBJECT_STRUCT_NEW (arena, struct ig_instance);
     struct ig_object   *plist[2] = {(parent == NULL ? NULL : IG_OBJECT (parent)), NULL};
 
-    ig_obj_init (IG_OBJ_INSTANCE, name, plist, IG_OBJECT (instance), storage);
+    ig_obj_init (IG_OBJ_INSTANCE, name, plist, IG_OBJECT (instance), storage, arena);
 
-    ig_obj_attr_set (IG_OBJECT (instance), "module", IG_OBJECT (module)->id, true);
+    ig_obj_attr_set_by_key (IG_OBJECT (instance), IG_AK_MODULE, IG_OBJECT (module)->id, true);
 
     instance->module = module;
     instance->parent = parent;
 
-    instance->adjustments = g_queue_new ();
-    instance->pins        = g_queue_new ();
+    instance->adjustments = ig_obj_queue_new (IG_OBJECT (instance));
+    instance->pins        = ig_obj_queue_new (IG_OBJECT (instance));
 
     return instance;
 }
@@ -688,7 +1089,7 @@ void ig_instance_free (struct ig_instance *instance)
     IG_OBJECT_CHILD_QUEUE_UNREF_AND_FREE (instance, adjustments, struct ig_adjustment, parent);
     IG_OBJECT_CHILD_QUEUE_UNREF_AND_FREE (instance, pins,        struct ig_pin,        parent);
 
-    g_slice_free (struct ig_instance, instance);
+    IG_OBJECT_STRUCT_FREE (struct ig_instance, instance);
 }
 
 
@@ -697,16 +1098,16 @@ void ig_instance_free (struct ig_instance *instance)
  * net data
  *******************************************************/
 
-struct ig_net *ig_net_new (const char *name, GStringChunk *storage)
+struct ig_net *ig_net_new (const char *name, GStringChunk *storage, struct ig_arena *arena)
 {
     if (name == NULL) return NULL;
 
-    struct ig_net    *net      = g_slice_new (struct ig_net);
+    struct ig_net    *net      = IG_OBJECT_STRUCT_NEW (arena, struct ig_net);
     struct ig_object *plist[1] = {NULL};
 
-    ig_obj_init (IG_OBJ_NET, name, plist, IG_OBJECT (net), storage);
+    ig_obj_init (IG_OBJ_NET, name, plist, IG_OBJECT (net), storage, arena);
 
-    net->objects = g_queue_new ();
+    net->objects = ig_obj_queue_new (IG_OBJECT (net));
 
     return net;
 }
@@ -738,26 +1139,26 @@ void ig_net_free (struct ig_net *net)
 
             ig_obj_unref (obj);
         }
-        g_queue_free (net->objects);
+        if (IG_OBJECT (net)->arena == NULL) g_queue_free (net->objects);
     }
 
-    g_slice_free (struct ig_net, net);
+    IG_OBJECT_STRUCT_FREE (struct ig_net, net);
 }
 
 /*******************************************************
  * generic data
  *******************************************************/
 
-struct ig_generic *ig_generic_new (const char *name, GStringChunk *storage)
+struct ig_generic *ig_generic_new (const char *name, GStringChunk *storage, struct ig_arena *arena)
 {
     if (name == NULL) return NULL;
 
-    struct ig_generic *generic  = g_slice_new (struct ig_generic);
+    struct ig_generic *generic  = IG_OBJECT_STRUCT_NEW (arena, struct ig_generic);
     struct ig_object  *plist[1] = {NULL};
 
-    ig_obj_init (IG_OBJ_GENERIC, name, plist, IG_OBJECT (generic), storage);
+    ig_obj_init (IG_OBJ_GENERIC, name, plist, IG_OBJECT (generic), storage, arena);
 
-    generic->objects = g_queue_new ();
+    generic->objects = ig_obj_queue_new (IG_OBJECT (generic));
 
     return generic;
 }
@@ -787,8 +1188,8 @@ void ig_generic_free (struct ig_generic *generic)
 
             ig_obj_unref (obj);
         }
-        g_queue_free (generic->objects);
+        if (IG_OBJECT (generic)->arena == NULL) g_queue_free (generic->objects);
     }
 
-    g_slice_free (struct ig_generic, generic);
+    IG_OBJECT_STRUCT_FREE (struct ig_generic, generic);
 }
@@ -56,12 +56,87 @@ enum ig_object_type {
     IG_OBJ_GENERIC
 };
 
+/**
+ * @brief Predefined attribute keys.
+ *
+ * Attribute names are interned to integer keys (see @ref ig_attr_key_intern).
+ * Keys of attributes used by the library itself are predefined,
+ * further keys are assigned on demand starting at @ref IG_AK_PREDEFINED_COUNT.
+ */
+enum ig_attr_key {
+    IG_AK_INVALID = 0,     /**< @brief No/invalid key. */
+    IG_AK_TYPE,            /**< @brief Attribute "type". */
+    IG_AK_ID,              /**< @brief Attribute "id". */
+    IG_AK_NAME,            /**< @brief Attribute "name". */
+    IG_AK_PARENT,          /**< @brief Attribute "parent". */
+    IG_AK_DIRECTION,       /**< @brief Attribute "direction". */
+    IG_AK_VALUE,           /**< @brief Attribute "value". */
+    IG_AK_LOCAL,           /**< @brief Attribute "local". */
+    IG_AK_CODE,            /**< @brief Attribute "code". */
+    IG_AK_MODULE,          /**< @brief Attribute "module". */
+    IG_AK_ILM,             /**< @brief Attribute "ilm". */
+    IG_AK_RESOURCE,        /**< @brief Attribute "resource". */
+    IG_AK_CONNECTION,      /**< @brief Attribute "connection". */
+    IG_AK_INVERT,          /**< @brief Attribute "invert". */
+    IG_AK_SIZE,            /**< @brief Attribute "size". */
+    IG_AK_SIGNAL,          /**< @brief Attribute "signal". */
+    IG_AK_NET,             /**< @brief Attribute "net". */
+    IG_AK_NETID,           /**< @brief Attribute "netid". */
+    IG_AK_PARAMETER,       /**< @brief Attribute "parameter". */
+    IG_AK_GENERIC,         /**< @brief Attribute "generic". */
+    IG_AK_GENERICID,       /**< @brief Attribute "genericid". */
+    IG_AK_PREDEFINED_COUNT /**< @brief Number of predefined keys. */
+};
+
 /**
  * @brief Attributes used in @ref ig_object
  */
 struct ig_attribute {
-    bool        constant; /**< @brief Attribute is write-once/read-only. */
-    const char *value;    /**< @brief Value of attribute. */
+    unsigned int key;      /**< @brief Interned key of attribute name. */
+    bool         constant; /**< @brief Attribute is write-once/read-only. */
+    const char  *value;    /**< @brief Value of attribute. */
+};
+
+/**
+ * @brief Bump-pointer memory region.
+ *
+ * Memory is taken from large blocks and only released as a whole (see @ref ig_arena_clear).
+ * Objects allocated from an arena are not reference counted.
+ * For memory allocation/free see @ref ig_arena_new and @ref ig_arena_free.
+ */
+struct ig_arena {
+    GSList *blocks;     /**< @brief Allocated blocks, current block first. List data: (char *) */
+    char   *pos;        /**< @brief Next free byte in current block. */
+    gsize   left;       /**< @brief Number of free bytes in current block. */
+    gsize   block_size; /**< @brief Size of regular blocks. */
+    GSList *destroy;    /**< @brief Cleanup callbacks run on clear, allocated from arena. List data: (struct @ref ig_arena_destroy *) */
+};
+
+/**
+ * @brief Cleanup callback registered with an @ref ig_arena.
+ */
+struct ig_arena_destroy {
+    GDestroyNotify func; /**< @brief Function to call. */
+    gpointer       data; /**< @brief Data to pass to @ref func. */
+};
+
+/**
+ * @brief Maximum number of attributes kept as plain sorted array in @ref ig_attribute_store.
+ */
+#define IG_ATTR_INLINE_MAX 16
+
+/**
+ * @brief Compact attribute storage of @ref ig_object.
+ *
+ * Up to @ref IG_ATTR_INLINE_MAX attributes are kept in an array sorted by key (binary search).
+ * If more attributes are added, the array is no longer kept sorted and an additional hash-index is created
+ * (not for objects allocated from an @ref ig_arena - these stay sorted).
+ */
+struct ig_attribute_store {
+    struct ig_attribute *data;  /**< @brief Attribute array. */
+    unsigned int         count; /**< @brief Number of attributes stored in @ref data. */
+    unsigned int         size;  /**< @brief Allocated number of attributes in @ref data. */
+    GHashTable          *index; /**< @brief Key-index or @c NULL. Key: (attribute key), value: (position in @ref data + 1). */
 };
 
 /**
@@ -74,14 +149,22 @@ struct ig_object {
     enum  ig_object_type type;         /**< @brief Type of Object stored in inheriting struct. */
     const char          *id;           /**< @brief Unique Object-ID. */
     const char          *name;         /**< @brief Object name. */
+    guint32              seq;          /**< @brief Creation sequence number assigned by database or 0. */
 
     int refcount;                      /**< @brief Reference count for memory management. */
 
-    GHashTable   *attributes;          /**< @brief Attributes. Key: (const char *), value: (struct @ref ig_attribute *). */
-    GStringChunk *string_storage;      /**< @brief Strings used here, in @ref attributes and inheriting struct. */
-    bool          string_storage_free; /**< @brief Free @ref string_storage when freeing object. */
+    struct ig_attribute_store attributes;          /**< @brief Attributes. */
+    GStringChunk             *string_storage;      /**< @brief Strings used here, in @ref attributes and inheriting struct. */
+    bool                      string_storage_free; /**< @brief Free @ref string_storage when freeing object. */
+    struct ig_arena          *arena;               /**< @brief Arena object memory is allocated from or @c NULL if reference counted. */
+    GHashTable               *child_index;         /**< @brief Lazily created name indexes of child queues (see @ref ig_obj_child_by_name). Key: <tt> (GQueue *) </tt> -> value: <tt> (GHashTable *) </tt> */
 };
 
+/**
+ * @brief Minimum child queue length for creating a name index.
+ */
+#define IG_OBJ_CHILD_INDEX_MIN 16
+
 /**
  * @brief Distinguish port direction in @ref ig_port.
  */
@@ -213,6 +296,8 @@ struct ig_module {
     GQueue *mod_instances;    /**< @brief Instances of module. Queue data: (struct @ref ig_instance *) */
     /* default instance of this module */
     struct ig_instance *default_instance; /**< @brief Default instance of non-resource module. */
+    /* name replacement for code adaption */
+    GHashTable *local_names;  /**< @brief Local port, declaration and parameter objects by net/generic name (see @ref ig_module_local_name_add). Key: <tt> (const char *) </tt> -> value: <tt> (struct @ref ig_object *) </tt> */
 };
 
 /**
@@ -305,6 +390,44 @@ struct ig_generic {
  * Functions
  *******************************************************/
 
+/**
+ * @brief Create new arena.
+ * @param block_size Size of memory blocks to allocate or 0 for default size.
+ * @return The newly allocated arena.
+ */
+struct ig_arena *ig_arena_new (gsize block_size);
+
+/**
+ * @brief Allocate memory from arena.
+ * @param arena Arena to allocate from.
+ * @param size Number of bytes to allocate.
+ * @return Pointer to uninitialized memory.
+ */
+gpointer ig_arena_alloc (struct ig_arena *arena, gsize size);
+
+/**
+ * @brief Release all memory allocated from arena.
+ * @param arena Arena to clear.
+ *
+ * Runtime only depends on the number of blocks and registered cleanup callbacks,
+ * not on the number of allocations.
+ */
+void ig_arena_clear (struct ig_arena *arena);
+
+/**
+ * @brief Register a cleanup callback to be run when the arena is cleared.
+ * @param arena Arena to use.
+ * @param func Function to call on clear.
+ * @param data Data to pass to @c func.
+ */
+void ig_arena_add_destroy (struct ig_arena *arena, GDestroyNotify func, gpointer data);
+
+/**
+ * @brief Free arena and all memory allocated from it.
+ * @param arena Arena to free.
+ */
+void ig_arena_free (struct ig_arena *arena);
+
 /**
  * @brief Human readable name of object type.
  * @param type Object type.
@@ -319,12 +442,13 @@ const char *ig_obj_type_name (enum ig_object_type type);
  * @param plist NULL-Terminated list of Parent-Objects in hierarchy.
  * @param obj object data structure.
  * @param storage GStringChunk string storage for shared string storage or @c NULL to create local string storage.
+ * @param arena Arena to allocate object data from or @c NULL.
  * @return The newly created object struct or @c NULL in case of an error.
  *
  * This function should be called within the allocation function of the actual data struct pointed to by @c obj.
  * The initial reference count is set to 0 (see @ref ig_obj_ref and @ref ig_obj_unref).
  */
-void ig_obj_init (enum ig_object_type type, const char *name, struct ig_object *plist[], struct ig_object *obj, GStringChunk *storage);
+void ig_obj_init (enum ig_object_type type, const char *name, struct ig_object *plist[], struct ig_object *obj, GStringChunk *storage, struct ig_arena *arena);
 
 /**
  * @brief Free object data.
@@ -356,6 +480,7 @@ void ig_obj_free_full (struct ig_object *obj);
  * in a module, instanciations of a module, pins in an instance).
  * Back-references in this case must not increment the ref-count - currently
  * they are deleted (set to @c NULL) when the managing object is freed.
+ * Objects allocated from an arena are not reference counted.
  */
 void ig_obj_ref (struct ig_object *obj);
 
@@ -366,9 +491,71 @@ void ig_obj_ref (struct ig_object *obj);
  * This decrements the object's reference count.
  * If the reference count reaches a value <= 0 the object is freed using
  * @ref ig_obj_free_full.
+ * Objects allocated from an arena are not reference counted.
  */
 void ig_obj_unref (struct ig_object *obj);
 
+/**
+ * @brief Append child to a queue of an object.
+ * @param obj Object owning the queue.
+ * @param queue Child queue of @c obj.
+ * @param data Child to append.
+ *
+ * For objects allocated from an arena the queue link is allocated from the same arena.
+ */
+void ig_obj_queue_push_tail (struct ig_object *obj, GQueue *queue, gpointer data);
+
+/**
+ * @brief Lookup child object by name in a queue of an object.
+ * @param obj Object owning the queue.
+ * @param queue Child queue of @c obj. Queue data: <tt> (struct @ref ig_object *) </tt>
+ * @param name Name of child.
+ * @return First child in @c queue with the given name or @c NULL.
+ *
+ * Queues with at least @ref IG_OBJ_CHILD_INDEX_MIN elements get a name index on first lookup,
+ * which is kept up to date by @ref ig_obj_queue_push_tail.
+ */
+struct ig_object *ig_obj_child_by_name (struct ig_object *obj, GQueue *queue, const char *name);
+
+
+/**
+ * @brief Get key of attribute name, register new key if necessary.
+ * @param name Name of attribute.
+ * @return Key of attribute or @ref IG_AK_INVALID if @c name is @c NULL.
+ */
+unsigned int ig_attr_key_intern (const char *name);
+
+/**
+ * @brief Get key of attribute name without registering it.
+ * @param name Name of attribute.
+ * @return Key of attribute or @ref IG_AK_INVALID if no attribute of this name has been registered.
+ */
+unsigned int ig_attr_key_lookup (const char *name);
+
+/**
+ * @brief Get name of attribute key.
+ * @param key Key of attribute.
+ * @return Name of attribute or @c NULL for unknown keys.
+ */
+const char *ig_attr_key_name (unsigned int key);
+
+/**
+ * @brief Set attribute of object by attribute key.
+ * @param obj Object where attribute is set.
+ * @param key Key of attribute to set.
+ * @param value Value to set.
+ * @param constant Make attribute constant (read-only).
+ * @return @c true on success, @c false in case of errors.
+ */
+bool ig_obj_attr_set_by_key (struct ig_object *obj, unsigned int key, const char *value, bool constant);
+
+/**
+ * @brief Get attribute of object by attribute key.
+ * @param obj Object to get attribute from.
+ * @param key Key of attribute to get.
+ * @return Value of specified attribute of object or @c NULL in case of an error/nonexisting attribute.
+ */
+const char *ig_obj_attr_get_by_key (struct ig_object *obj, unsigned int key);
 
 /**
  * @brief Set attribute of object.
@@ -411,12 +598,13 @@ bool ig_obj_attr_set_from_gslist (struct ig_object *obj, GList *list);
  * @param dir Port direction.
  * @param parent Module where port is to be added.
  * @param storage String storage to use or @c NULL.
+ * @param arena Arena to allocate from or @c NULL.
  * @return The newly allocated port structure or @c NULL in case of an error.
  *
  * This creates the port with the related object and adds the port to the specified parent module.
  * Default attributes are set in the related object.
  */
-struct ig_port *ig_port_new  (const char *name, enum ig_port_dir dir, struct ig_module *parent, GStringChunk *storage);
+struct ig_port *ig_port_new  (const char *name, enum ig_port_dir dir, struct ig_module *parent, GStringChunk *storage, struct ig_arena *arena);
 
 /**
  * @brief Free port data struct.
@@ -433,12 +621,13 @@ void ig_port_free (struct ig_port *port);
  * @param local Local parameter property.
  * @param parent Module where parameter is to be added.
  * @param storage String storage to use or @c NULL.
+ * @param arena Arena to allocate from or @c NULL.
  * @return The newly allocated parameter structure or @c NULL in case of an error.
  *
  * This creates the parameter with the related object and adds the parameter to the specified parent module.
  * Default attributes are set in the related object.
  */
-struct ig_param *ig_param_new  (const char *name, const char *value, bool local, struct ig_module *parent, GStringChunk *storage);
+struct ig_param *ig_param_new  (const char *name, const char *value, bool local, struct ig_module *parent, GStringChunk *storage, struct ig_arena *arena);
 
 /**
  * @brief Free parameter data struct.
@@ -453,12 +642,13 @@ void ig_param_free (struct ig_param *param);
  * @param name Name of declared variable.
  * @param parent Module where declaration is to be added.
  * @param storage String storage to use or @c NULL.
+ * @param arena Arena to allocate from or @c NULL.
  * @return The newly allocated declaration structure or @c NULL in case of an error.
  *
  * This creates the declaration with the related object and adds the declaration to the specified parent module.
  * Default attributes are set in the related object.
  */
-struct ig_decl *ig_decl_new (const char *name, struct ig_module *parent, GStringChunk *storage);
+struct ig_decl *ig_decl_new (const char *name, struct ig_module *parent, GStringChunk *storage, struct ig_arena *arena);
 
 /**
  * @brief Free declaration data struct.
@@ -474,12 +664,13 @@ void ig_decl_free (struct ig_decl *decl);
  * @param codesection Code of codesection.
  * @param parent Module where codesection is to be added.
  * @param storage String storage to use or @c NULL.
+ * @param arena Arena to allocate from or @c NULL.
  * @return The newly allocated codesection structure or @c NULL in case of an error.
  *
  * This creates the codesection with the related object and adds the codesection to the specified parent module.
  * Default attributes are set in the related object.
  */
-struct ig_code *ig_code_new  (const char *name, const char *codesection, struct ig_module *parent, GStringChunk *storage);
+struct ig_code *ig_code_new  (const char *name, const char *codesection, struct ig_module *parent, GStringChunk *storage, struct ig_arena *arena);
 
 /**
  * @brief Free codesection data struct.
@@ -494,12 +685,13 @@ void ig_code_free (struct ig_code *code);
  * @param name Name of register.
  * @param parent Regfile-entry where register is to be added.
  * @param storage String storage to use or @c NULL.
+ * @param arena Arena to allocate from or @c NULL.
  * @return The newly allocated register structure or @c NULL in case of an error.
  *
  * This creates the register with the related object and adds the register to the specified parent regfile-entry.
  * Default attributes are set in the related object.
  */
-struct ig_rf_reg *ig_rf_reg_new (const char *name, struct ig_rf_entry *parent, GStringChunk *storage);
+struct ig_rf_reg *ig_rf_reg_new (const char *name, struct ig_rf_entry *parent, GStringChunk *storage, struct ig_arena *arena);
 
 /**
  * @brief Free register data struct.
@@ -514,12 +706,13 @@ void ig_rf_reg_free (struct ig_rf_reg *reg);
  * @param name Name of regfile-entry.
  * @param parent Regfile where regfile-entry is to be added.
  * @param storage String storage to use or @c NULL.
+ * @param arena Arena to allocate from or @c NULL.
  * @return The newly allocated regfile-entry structure or @c NULL in case of an error.
  *
  * This creates the regfile-entry with the related object and adds the regfile-entry to the specified parent regfile.
  * Default attributes are set in the related object.
  */
-struct ig_rf_entry *ig_rf_entry_new (const char *name, struct ig_rf_regfile *parent, GStringChunk *storage);
+struct ig_rf_entry *ig_rf_entry_new (const char *name, struct ig_rf_regfile *parent, GStringChunk *storage, struct ig_arena *arena);
 
 /**
  * @brief Free regfile-entry data struct.
@@ -534,12 +727,13 @@ void ig_rf_entry_free (struct ig_rf_entry *entry);
  * @param name Name of regfile.
  * @param parent Module where regfile is to be added.
  * @param storage String storage to use or @c NULL.
+ * @param arena Arena to allocate from or @c NULL.
  * @return The newly allocated regfile structure or @c NULL in case of an error.
  *
  * This creates the regfile with the related object and adds the regfile to the specified parent module.
  * Default attributes are set in the related object.
  */
-struct ig_rf_regfile *ig_rf_regfile_new (const char *name, struct ig_module *parent, GStringChunk *storage);
+struct ig_rf_regfile *ig_rf_regfile_new (const char *name, struct ig_module *parent, GStringChunk *storage, struct ig_arena *arena);
 
 /**
  * @brief Free regfile data struct.
@@ -555,12 +749,13 @@ void ig_rf_regfile_free (struct ig_rf_regfile *regfile);
  * @param ilm ILM property.
  * @param resource Resource property. Resource modules must not contain any regfiles, instances, codesections.
  * @param storage String storage to use or @c NULL.
+ * @param arena Arena to allocate from or @c NULL.
  * @return The newly allocated module structure or @c NULL in case of an error.
  *
  * This creates the module with the related object.
  * Default attributes are set in the related object.
  */
-struct ig_module *ig_module_new (const char *name, bool ilm, bool resource, GStringChunk *storage);
+struct ig_module *ig_module_new (const char *name, bool ilm, bool resource, GStringChunk *storage, struct ig_arena *arena);
 
 /**
  * @brief Free module data struct.
@@ -570,18 +765,31 @@ struct ig_module *ig_module_new (const char *name, bool ilm, bool resource, GStr
  */
 void ig_module_free (struct ig_module *module);
 
+/**
+ * @brief Register local object of a net or generic in module.
+ * @param module Pointer to module data struct.
+ * @param name Name of net or generic.
+ * @param local Port, declaration or parameter of module connected to net or generic.
+ *
+ * Parameters take precedence over declarations, declarations over ports of the same name.
+ * Among objects of the same kind the one created last is used.
+ * The registered objects provide the name replacement map for code adaption.
+ */
+void ig_module_local_name_add (struct ig_module *module, const char *name, struct ig_object *local);
+
 /**
  * @brief Create new pin data struct.
  * @param name Name of pin.
  * @param connection Value/wire connectod to pin.
  * @param parent Instance where pin is to be added.
  * @param storage String storage to use or @c NULL.
+ * @param arena Arena to allocate from or @c NULL.
  * @return The newly allocated pin structure or @c NULL in case of an error.
  *
  * This creates the pin with the related object and adds the pin to the specified parent instance.
  * Default attributes are set in the related object.
  */
-struct ig_pin *ig_pin_new (const char *name, const char *connection, struct ig_instance *parent, GStringChunk *storage);
+struct ig_pin *ig_pin_new (const char *name, const char *connection, struct ig_instance *parent, GStringChunk *storage, struct ig_arena *arena);
 
 /**
  * @brief Free pin data struct.
@@ -597,12 +805,13 @@ void ig_pin_free (struct ig_pin *pin);
  * @param value Adjusted value for parameter.
  * @param parent Instance where adjustment is to be added.
  * @param storage String storage to use or @c NULL.
+ * @param arena Arena to allocate from or @c NULL.
  * @return The newly allocated adjustment structure or @c NULL in case of an error.
  *
  * This creates the adjustment with the related object and adds the adjustment to the specified parent instance.
  * Default attributes are set in the related object.
  */
-struct ig_adjustment *ig_adjustment_new (const char *name, const char *value, struct ig_instance *parent, GStringChunk *storage);
+struct ig_adjustment *ig_adjustment_new (const char *name, const char *value, struct ig_instance *parent, GStringChunk *storage, struct ig_arena *arena);
 
 /**
  * @brief Free adjustment data struct.
@@ -618,12 +827,13 @@ void ig_adjustment_free (struct ig_adjustment *adjustment);
  * @param module Module to be instanciated.
  * @param parent Module where instance is to be added or @c NULL.
  * @param storage String storage to use or @c NULL.
+ * @param arena Arena to allocate from or @c NULL.
  * @return The newly allocated instance structure or @c NULL in case of an error.
  *
  * This creates the instance with the related object and adds the instance to the specified parent module.
  * Default attributes are set in the related object.
  */
-struct ig_instance *ig_instance_new (const char *name, struct ig_module *module, struct ig_module *parent, GStringChunk *storage);
+struct ig_instance *ig_instance_new (const char *name, struct ig_module *module, struct ig_module *parent, GStringChunk *storage, struct ig_arena *arena);
 
 /**
  * @brief Free instance data struct.
@@ -638,11 +848,12 @@ void ig_instance_free (struct ig_instance *instance);
  * @brief Create new net data struct.
  * @param name Name of net.
  * @param storage String storage to use or @c NULL.
+ * @param arena Arena to allocate from or @c NULL.
  * @return The newly allocated net structure or @c NULL in case of an error.
  *
  * Default attributes are set in the related object.
  */
-struct ig_net *ig_net_new (const char *name, GStringChunk *storage);
+struct ig_net *ig_net_new (const char *name, GStringChunk *storage, struct ig_arena *arena);
 
 /**
  * @brief Free net data struct.
@@ -656,11 +867,12 @@ void ig_net_free (struct ig_net *net);
  * @brief Create new generic data struct.
  * @param name Name of generic.
  * @param storage String storage to use or @c NULL.
+ * @param arena Arena to allocate from or @c NULL.
  * @return The newly allocated generic structure or @c NULL in case of an error.
  *
  * Default attributes are set in the related object.
  */
-struct ig_generic *ig_generic_new (const char *name, GStringChunk *storage);
+struct ig_generic *ig_generic_new (const char *name, GStringChunk *storage, struct ig_arena *arena);
 
 /**
  * @brief Free generic data struct.
@@ -24,7 +24,12 @@
 #include <string.h>
 
 /* static functions */
+static GList   *ig_lib_connection_hierarchies (struct ig_lib_db *db, struct ig_lib_connection_info *source, GList *targets, bool *error);
+static bool     ig_lib_connection_create (struct ig_lib_db *db, const char *signame, GList *hier_start_list, struct ig_net **gen_net, const char **errmsg);
+static void     ig_lib_hierarchy_list_free (GList *hier_start_list);
 static GList   *ig_lib_gen_hierarchy (struct ig_lib_db *db, struct ig_lib_connection_info *cinfo);
+static GList   *ig_lib_root_path     (struct ig_lib_db *db, struct ig_instance *inst, enum ig_lib_connection_dir dir);
+static void     ig_lib_root_path_free (gpointer data);
 static bool     ig_lib_check_cycle (struct ig_lib_db *db, struct ig_instance *child, struct ig_module *parent);
 static GNode   *ig_lib_merge_hierarchy_list (struct ig_lib_db *db, GList *hier_list, const char *signame);
 static void     ig_lib_htree_print (GNode *hier_tree);
@@ -39,6 +44,8 @@ static gboolean ig_lib_htree_free_tfunc (GNode *node, gpointer data);
 static struct ig_net     *ig_lib_add_net     (struct ig_lib_db *db, const char *name, GList *objs);
 static struct ig_generic *ig_lib_add_generic (struct ig_lib_db *db, const char *name, GList *objs);
 
+static void ig_lib_db_register_object (struct ig_lib_db *db, const char *id, struct ig_object *obj);
+
 static char *ig_lib_gen_name_signal  (struct ig_lib_db *db, const char *basename);
 static char *ig_lib_gen_name_pinport (struct ig_lib_db *db, const char *basename, enum ig_port_dir dir);
 static char *ig_lib_rm_suffix_pinport (struct ig_lib_db *db, const char *pinportname);
@@ -56,6 +63,9 @@ static bool  ig_lib_gen_name_iscaps (const char *name);
 static int ig_mman_cnt_coninfo = 0;
 #endif
 
+/* source of unique database generations */
+static unsigned long ig_lib_db_generation_counter = 0;
+
 /* header functions */
 struct ig_lib_db *ig_lib_db_new ()
 {
@@ -73,13 +83,19 @@ struct ig_lib_db *ig_lib_db_new ()
     result->generics_by_id    = g_hash_table_new_full (g_str_hash, g_str_equal, NULL, (GDestroyNotify)ig_obj_unref);
     result->generics_by_name  = g_hash_table_new_full (g_str_hash, g_str_equal, NULL, (GDestroyNotify)ig_obj_unref);
 
+    result->root_paths = g_hash_table_new_full (g_direct_hash, g_direct_equal, NULL, ig_lib_root_path_free);
+
     result->str_chunks = g_string_chunk_new (128);
+    result->arena      = NULL;
+    result->generation = ++ig_lib_db_generation_counter;
+    result->last_seq   = 0;
 
     return result;
 }
 
 void ig_lib_db_clear (struct ig_lib_db *db)
 {
+    g_hash_table_remove_all (db->root_paths);
     g_hash_table_remove_all (db->modules_by_id);
     g_hash_table_remove_all (db->modules_by_name);
     g_hash_table_remove_all (db->instances_by_id);
@@ -92,13 +108,40 @@ void ig_lib_db_clear (struct ig_lib_db *db)
     g_hash_table_remove_all (db->generics_by_name);
     g_hash_table_remove_all (db->objects_by_id);
 
+    db->last_seq = 0;
+
     g_string_chunk_clear (db->str_chunks);
+    /* arena objects are not refcounted - all dropped at once */
+    ig_arena_clear (db->arena);
+
+    db->generation = ++ig_lib_db_generation_counter;
+}
+
+bool ig_lib_db_set_arena (struct ig_lib_db *db, bool enable)
+{
+    if (db == NULL) return false;
+    if (enable == (db->arena != NULL)) return true;
+
+    if (g_hash_table_size (db->objects_by_id) > 0) {
+        log_error ("DBAre", "allocation mode can only be changed on empty database");
+        return false;
+    }
+
+    if (enable) {
+        db->arena = ig_arena_new (0);
+    } else {
+        ig_arena_free (db->arena);
+        db->arena = NULL;
+    }
+
+    return true;
 }
 
 void ig_lib_db_free (struct ig_lib_db *db)
 {
     if (db == NULL) return;
 
+    g_hash_table_destroy (db->root_paths);
     g_hash_table_destroy (db->modules_by_id);
     g_hash_table_destroy (db->modules_by_name);
     g_hash_table_destroy (db->instances_by_id);
@@ -112,10 +155,19 @@ void ig_lib_db_free (struct ig_lib_db *db)
     g_hash_table_destroy (db->objects_by_id);
 
     g_string_chunk_free (db->str_chunks);
+    ig_arena_free (db->arena);
 
     g_slice_free (struct ig_lib_db, db);
 }
 
+/* add object to id-lookup and assign creation sequence number - id must be stored in db->str_chunks */
+static void ig_lib_db_register_object (struct ig_lib_db *db, const char *id, struct ig_object *obj)
+{
+    obj->seq = ++db->last_seq;
+
+    g_hash_table_insert (db->objects_by_id, (gpointer)id, obj);
+}
+
 struct ig_module *ig_lib_add_module (struct ig_lib_db *db, const char *name, bool ilm, bool resource)
 {
     if (db == NULL) return NULL;
@@ -126,7 +178,7 @@ struct ig_module *ig_lib_add_module (struct ig_lib_db *db, const char *name, boo
         return NULL;
     }
 
-    struct ig_module *mod = ig_module_new (name, ilm, resource, db->str_chunks);
+    struct ig_module *mod = ig_module_new (name, ilm, resource, db->str_chunks, db->arena);
 
     if (g_hash_table_contains (db->objects_by_id, IG_OBJECT (mod)->id)) {
         log_errorint ("EAExi", "object %s already exists", IG_OBJECT (mod)->id);
@@ -139,7 +191,7 @@ struct ig_module *ig_lib_add_module (struct ig_lib_db *db, const char *name, boo
 
     g_hash_table_insert (db->modules_by_name, l_name, IG_OBJECT (mod));
     g_hash_table_insert (db->modules_by_id,   l_id,   IG_OBJECT (mod));
-    g_hash_table_insert (db->objects_by_id,   l_id,   IG_OBJECT (mod));
+    ig_lib_db_register_object (db, l_id, IG_OBJECT (mod));
     ig_obj_ref (IG_OBJECT (mod));
     ig_obj_ref (IG_OBJECT (mod));
     ig_obj_ref (IG_OBJECT (mod));
@@ -149,17 +201,19 @@ struct ig_module *ig_lib_add_module (struct ig_lib_db *db, const char *name, boo
 
 struct ig_port *ig_lib_add_port (struct ig_lib_db *db, struct ig_module *mod, enum ig_port_dir dir, const char *port_name)
 {
+    struct ig_object *existing = ig_obj_child_by_name (IG_OBJECT (mod), mod->ports, port_name);
+    if (existing != NULL) {
+        log_error ("HTrPS", "Already declared port %s", existing->id);
+        return NULL;
+    }
+
     /* create a port */
-    struct ig_port *mod_port = ig_port_new (port_name, dir, mod, db->str_chunks);
+    struct ig_port *mod_port = ig_port_new (port_name, dir, mod, db->str_chunks, db->arena);
 
-    if (g_hash_table_contains (db->objects_by_id, IG_OBJECT (mod_port)->id)) {
-        log_error ("HTrPS", "Already declared port %s", IG_OBJECT (mod_port)->id);
-        ig_port_free (mod_port);
-        mod_port = NULL;
-    } else {
-        g_queue_push_tail (mod->ports, mod_port);
+    if (mod_port != NULL) {
+        ig_obj_queue_push_tail (IG_OBJECT (mod), mod->ports, mod_port);
         ig_obj_ref (IG_OBJECT (mod_port));
-        g_hash_table_insert (db->objects_by_id, g_string_chunk_insert_const (db->str_chunks, IG_OBJECT (mod_port)->id), IG_OBJECT (mod_port));
+        ig_lib_db_register_object (db, g_string_chunk_insert_const (db->str_chunks, IG_OBJECT (mod_port)->id), IG_OBJECT (mod_port));
         ig_obj_ref (IG_OBJECT (mod_port));
     }
 
@@ -168,18 +222,20 @@ struct ig_port *ig_lib_add_port (struct ig_lib_db *db, struct ig_module *mod, en
 
 struct ig_pin *ig_lib_add_pin (struct ig_lib_db *db, struct ig_instance *inst, const char *pin_name, const char *conn_name, const char *invert_attr)
 {
+    struct ig_object *existing = ig_obj_child_by_name (IG_OBJECT (inst), inst->pins, pin_name);
+    if (existing != NULL) {
+        log_error ("CPin", "Already declared pin %s", existing->id);
+        return NULL;
+    }
+
     /* create a pin */
-    struct ig_pin *inst_pin = ig_pin_new (pin_name, conn_name, inst, db->str_chunks);
+    struct ig_pin *inst_pin = ig_pin_new (pin_name, conn_name, inst, db->str_chunks, db->arena);
 
-    ig_obj_attr_set (IG_OBJECT (inst_pin), "invert", invert_attr, false);
-    if (g_hash_table_contains (db->objects_by_id, IG_OBJECT (inst_pin)->id)) {
-        log_error ("CPin", "Already declared pin %s", IG_OBJECT (inst_pin)->id);
-        ig_pin_free (inst_pin);
-        inst_pin = NULL;
-    } else {
-        g_hash_table_insert (db->objects_by_id, g_string_chunk_insert_const (db->str_chunks, IG_OBJECT (inst_pin)->id), IG_OBJECT (inst_pin));
+    if (inst_pin != NULL) {
+        ig_obj_attr_set_by_key (IG_OBJECT (inst_pin), IG_AK_INVERT, invert_attr, false);
+        ig_lib_db_register_object (db, g_string_chunk_insert_const (db->str_chunks, IG_OBJECT (inst_pin)->id), IG_OBJECT (inst_pin));
         ig_obj_ref (IG_OBJECT (inst_pin));
-        g_queue_push_tail (inst->pins, inst_pin);
+        ig_obj_queue_push_tail (IG_OBJECT (inst), inst->pins, inst_pin);
         ig_obj_ref (IG_OBJECT (inst_pin));
     }
 
@@ -188,28 +244,25 @@ struct ig_pin *ig_lib_add_pin (struct ig_lib_db *db, struct ig_instance *inst, c
 
 static bool ig_lib_check_cycle (struct ig_lib_db *db, struct ig_instance *child, struct ig_module *parent)
 {
-    bool result = false;
-
     if (child == NULL) return false;
     if (parent == NULL) return false;
 
-    struct ig_lib_connection_info *start = ig_lib_connection_info_new (db->str_chunks, IG_OBJECT (parent), NULL, IG_LCDIR_DEFAULT);
-    GList                         *hlist = ig_lib_gen_hierarchy (db, start);
-
-    if (hlist == NULL) return false;
+    /* walk up to root of parent */
+    struct ig_object *root = IG_OBJECT (parent);
+    struct ig_module *mod  = parent;
 
-    struct ig_object *root = ((struct ig_lib_connection_info *)hlist->data)->obj;
-
-    if (strcmp (root->id, IG_OBJECT (child)->id) == 0) {
-        result = true;
-    }
+    while (mod->default_instance != NULL) {
+        struct ig_instance *inst = mod->default_instance;
 
-    for (GList *li = hlist; li != NULL; li = li->next) {
-        ig_lib_connection_info_free ((struct ig_lib_connection_info *)li->data);
+        if (inst->parent == NULL) {
+            root = IG_OBJECT (inst);
+            break;
+        }
+        root = IG_OBJECT (inst->parent);
+        mod  = inst->parent;
     }
-    g_list_free (hlist);
 
-    return result;
+    return (root == IG_OBJECT (child));
 }
 
 struct ig_instance *ig_lib_add_instance (struct ig_lib_db *db, const char *name, struct ig_module *type, struct ig_module *parent)
@@ -248,17 +301,20 @@ struct ig_instance *ig_lib_add_instance (struct ig_lib_db *db, const char *name,
             return NULL;
         }
 
+        /* hierarchy above module changes */
+        g_hash_table_remove_all (db->root_paths);
+
         inst->parent = parent;
-        ig_obj_attr_set (IG_OBJECT (inst), "parent", IG_OBJECT (parent)->id, true);
-        g_queue_push_tail (parent->child_instances, inst);
-        g_queue_push_tail (type->mod_instances, inst);
+        ig_obj_attr_set_by_key (IG_OBJECT (inst), IG_AK_PARENT, IG_OBJECT (parent)->id, true);
+        ig_obj_queue_push_tail (IG_OBJECT (parent), parent->child_instances, inst);
+        ig_obj_queue_push_tail (IG_OBJECT (type), type->mod_instances, inst);
         ig_obj_ref (IG_OBJECT (inst));
     } else {
-        inst = ig_instance_new (name, type, parent, db->str_chunks);
+        inst = ig_instance_new (name, type, parent, db->str_chunks, db->arena);
 
-        g_queue_push_tail (parent->child_instances, inst);
+        ig_obj_queue_push_tail (IG_OBJECT (parent), parent->child_instances, inst);
         ig_obj_ref (IG_OBJECT (inst));
-        g_queue_push_tail (type->mod_instances, inst);
+        ig_obj_queue_push_tail (IG_OBJECT (type), type->mod_instances, inst);
         ig_obj_ref (IG_OBJECT (inst));
     }
 
@@ -267,7 +323,7 @@ struct ig_instance *ig_lib_add_instance (struct ig_lib_db *db, const char *name,
 
     g_hash_table_insert (db->instances_by_name, l_name, IG_OBJECT (inst));
     g_hash_table_insert (db->instances_by_id,   l_id,   IG_OBJECT (inst));
-    g_hash_table_insert (db->objects_by_id,     l_id,   IG_OBJECT (inst));
+    ig_lib_db_register_object (db, l_id, IG_OBJECT (inst));
     ig_obj_ref (IG_OBJECT (inst));
     ig_obj_ref (IG_OBJECT (inst));
     ig_obj_ref (IG_OBJECT (inst));
@@ -282,7 +338,7 @@ struct ig_code *ig_lib_add_codesection (struct ig_lib_db *db, const char *name,
     if (parent == NULL) return NULL;
 
     log_debug ("LACSc", "new codesection for module %s...", IG_OBJECT (parent)->name);
-    struct ig_code *cs = ig_code_new (name, code, parent, db->str_chunks);
+    struct ig_code *cs = ig_code_new (name, code, parent, db->str_chunks, db->arena);
 
     if (cs == NULL) {
         log_error ("LACSc", "error while creating new codesection for module %s", IG_OBJECT (parent)->name);
@@ -291,10 +347,10 @@ struct ig_code *ig_lib_add_codesection (struct ig_lib_db *db, const char *name,
 
     char *l_id = g_string_chunk_insert_const (db->str_chunks, IG_OBJECT (cs)->id);
 
-    g_queue_push_tail (parent->code, cs);
+    ig_obj_queue_push_tail (IG_OBJECT (parent), parent->code, cs);
     ig_obj_ref (IG_OBJECT (cs));
 
-    g_hash_table_insert (db->objects_by_id, l_id, IG_OBJECT (cs));
+    ig_lib_db_register_object (db, l_id, IG_OBJECT (cs));
     ig_obj_ref (IG_OBJECT (cs));
     log_debug ("LACSc", "...added codesection for module %s", IG_OBJECT (parent)->name);
 
@@ -313,7 +369,7 @@ struct ig_rf_regfile *ig_lib_add_regfile (struct ig_lib_db *db, const char *name
     }
 
     log_debug ("LARgf", "new regfile %s for module %s...", name, IG_OBJECT (parent)->name);
-    struct ig_rf_regfile *rf = ig_rf_regfile_new (name, parent, db->str_chunks);
+    struct ig_rf_regfile *rf = ig_rf_regfile_new (name, parent, db->str_chunks, db->arena);
 
     if (rf == NULL) {
         log_error ("LARgf", "error while creating new regfile %s for module %s", name, IG_OBJECT (parent)->name);
@@ -330,12 +386,12 @@ struct ig_rf_regfile *ig_lib_add_regfile (struct ig_lib_db *db, const char *name
     char *l_id   = g_string_chunk_insert_const (db->str_chunks, IG_OBJECT (rf)->id);
     char *l_name = g_string_chunk_insert_const (db->str_chunks, IG_OBJECT (rf)->name);
 
-    g_queue_push_tail (parent->regfiles, rf);
+    ig_obj_queue_push_tail (IG_OBJECT (parent), parent->regfiles, rf);
     ig_obj_ref (IG_OBJECT (rf));
 
     g_hash_table_insert (db->regfiles_by_name, l_name, IG_OBJECT (rf));
     g_hash_table_insert (db->regfiles_by_id,   l_id,   IG_OBJECT (rf));
-    g_hash_table_insert (db->objects_by_id,    l_id,   IG_OBJECT (rf));
+    ig_lib_db_register_object (db, l_id, IG_OBJECT (rf));
     ig_obj_ref (IG_OBJECT (rf));
     ig_obj_ref (IG_OBJECT (rf));
     ig_obj_ref (IG_OBJECT (rf));
@@ -350,8 +406,13 @@ struct ig_rf_entry *ig_lib_add_regfile_entry (struct ig_lib_db *db, const char *
     if (name == NULL) return NULL;
     if (parent == NULL) return NULL;
 
+    if (ig_obj_child_by_name (IG_OBJECT (parent), parent->entries, name) != NULL) {
+        log_error ("LARfE", "Regfile-Entry %s already exists in regfile %s", name, IG_OBJECT (parent)->name);
+        return NULL;
+    }
+
     log_debug ("LARfE", "new entry %s for regfile %s...", name, IG_OBJECT (parent)->name);
-    struct ig_rf_entry *entry = ig_rf_entry_new (name, parent, db->str_chunks);
+    struct ig_rf_entry *entry = ig_rf_entry_new (name, parent, db->str_chunks, db->arena);
 
     if (entry == NULL) {
         log_error ("LARfE", "error while creating new entry %s for regfile %s", name, IG_OBJECT (parent)->name);
@@ -360,19 +421,12 @@ struct ig_rf_entry *ig_lib_add_regfile_entry (struct ig_lib_db *db, const char *
 
     char *l_id = g_string_chunk_insert_const (db->str_chunks, IG_OBJECT (entry)->id);
 
-    if (g_hash_table_contains (db->objects_by_id, l_id)) {
-        log_error ("LARfE", "Regfile-Entry %s already exists in regfile %s", IG_OBJECT (entry)->name, IG_OBJECT (parent)->name);
-        ig_rf_entry_free (entry);
+    ig_obj_queue_push_tail (IG_OBJECT (parent), parent->entries, entry);
+    ig_obj_ref (IG_OBJECT (entry));
 
-        entry = NULL;
-    } else {
-        g_queue_push_tail (parent->entries, entry);
-        ig_obj_ref (IG_OBJECT (entry));
-
-        g_hash_table_insert (db->objects_by_id, l_id, IG_OBJECT (entry));
-        ig_obj_ref (IG_OBJECT (entry));
-        log_debug ("LARfE", "...added entry %s for regfile %s", name, IG_OBJECT (parent)->name);
-    }
+    ig_lib_db_register_object (db, l_id, IG_OBJECT (entry));
+    ig_obj_ref (IG_OBJECT (entry));
+    log_debug ("LARfE", "...added entry %s for regfile %s", name, IG_OBJECT (parent)->name);
 
     return entry;
 }
@@ -383,8 +437,13 @@ struct ig_rf_reg *ig_lib_add_regfile_reg (struct ig_lib_db *db, const char *name
     if (name == NULL) return NULL;
     if (parent == NULL) return NULL;
 
+    if (ig_obj_child_by_name (IG_OBJECT (parent), parent->regs, name) != NULL) {
+        log_error ("LARfR", "Regfile-reg %s already exists in regfile-entry %s", name, IG_OBJECT (parent)->name);
+        return NULL;
+    }
+
     log_debug ("LARfR", "new reg %s for regfile-entrty %s...", name, IG_OBJECT (parent)->name);
-    struct ig_rf_reg *reg = ig_rf_reg_new (name, parent, db->str_chunks);
+    struct ig_rf_reg *reg = ig_rf_reg_new (name, parent, db->str_chunks, db->arena);
 
     if (reg == NULL) {
         log_error ("LARfR", "error while creating new reg %s for regfile-entry %s", name, IG_OBJECT (parent)->name);
@@ -393,19 +452,12 @@ struct ig_rf_reg *ig_lib_add_regfile_reg (struct ig_lib_db *db, const char *name
 
     char *l_id = g_string_chunk_insert_const (db->str_chunks, IG_OBJECT (reg)->id);
 
-    if (g_hash_table_contains (db->objects_by_id, l_id)) {
-        log_error ("LARfR", "Regfile-reg %s already exists in regfile-entry %s", IG_OBJECT (reg)->name, IG_OBJECT (parent)->name);
-        ig_rf_reg_free (reg);
+    ig_obj_queue_push_tail (IG_OBJECT (parent), parent->regs, reg);
+    ig_obj_ref (IG_OBJECT (reg));
 
-        reg = NULL;
-    } else {
-        g_queue_push_tail (parent->regs, reg);
-        ig_obj_ref (IG_OBJECT (reg));
-
-        g_hash_table_insert (db->objects_by_id, l_id, IG_OBJECT (reg));
-        ig_obj_ref (IG_OBJECT (reg));
-        log_debug ("LARfR", "...added reg %s for regfile-entry %s", name, IG_OBJECT (parent)->name);
-    }
+    ig_lib_db_register_object (db, l_id, IG_OBJECT (reg));
+    ig_obj_ref (IG_OBJECT (reg));
+    log_debug ("LARfR", "...added reg %s for regfile-entry %s", name, IG_OBJECT (parent)->name);
 
     return reg;
 }
@@ -413,39 +465,8 @@ struct ig_rf_reg *ig_lib_add_regfile_reg (struct ig_lib_db *db, const char *name
 
 bool ig_lib_connection (struct ig_lib_db *db, const char *signame, struct ig_lib_connection_info *source, GList *targets, struct ig_net **gen_net)
 {
-    GList *hier_start_list = NULL;
-
-    log_debug ("LConn", "creating individual hierarchies...");
-    bool error = false;
-
-    if (source != NULL) {
-        source->dir         = IG_LCDIR_UP;
-        source->is_explicit = true;
-        log_debug ("LConn", "creating startpoint hierarchy...");
-        GList *source_hier = ig_lib_gen_hierarchy (db, source);
-        if (source_hier == NULL) {
-            error = true;
-        } else {
-            hier_start_list = g_list_prepend (hier_start_list, source_hier);
-        }
-        log_debug ("LConn", "startpoint hierarchy depth: %d", g_list_length (source_hier));
-    }
-
-    for (GList *li = targets; li != NULL; li = li->next) {
-        struct ig_lib_connection_info *start = (struct ig_lib_connection_info *)li->data;
-        start->is_explicit = true;
-
-        log_debug ("LConn", "creating targetpoint hierarchy...");
-        GList *target_hier = ig_lib_gen_hierarchy (db, start);
-        if (target_hier == NULL) {
-            error = true;
-        } else {
-            hier_start_list = g_list_prepend (hier_start_list, target_hier);
-        }
-        log_debug ("LConn", "targetpoint hierarchy depth: %d", g_list_length (target_hier));
-    }
-
-    g_list_free (targets);
+    bool   error           = false;
+    GList *hier_start_list = ig_lib_connection_hierarchies (db, source, targets, &error);
 
     bool result = true;
 
@@ -460,63 +481,74 @@ bool ig_lib_connection (struct ig_lib_db *db, const char *signame, struct ig_lib
         goto l_ig_lib_connection_final_free_hierlist;
     }
 
-    log_debug ("LConn", "merging to hierarchy tree...");
-    /* create hierarchy tree */
-    GNode *hier_tree = ig_lib_merge_hierarchy_list (db, hier_start_list, signame);
+    const char *errmsg = NULL;
+    result = ig_lib_connection_create (db, signame, hier_start_list, gen_net, &errmsg);
 
-    if (hier_tree == NULL) {
-        result = false;
-        goto l_ig_lib_connection_final_free_hierlist;
-    }
-
-    log_debug ("LConn", "printing hierarchy tree...");
-    /* debug: printout */
-    ig_lib_htree_print (hier_tree);
+l_ig_lib_connection_final_free_hierlist:
+    ig_lib_hierarchy_list_free (hier_start_list);
 
-    log_debug ("LConn", "reducing hierarchy tree...");
-    hier_tree = ig_lib_htree_reduce (hier_tree);
-    if (hier_tree == NULL) {
-        log_warn ("LConn", "Unable to create signal %s, because of insufficient hierarchy information.", signame);
-        result = false;
-        goto l_ig_lib_connection_final_free_hierlist;
-    }
+    log_debug ("LConn", "finished...");
+    return result;
+}
 
-    ig_lib_htree_print (hier_tree);
+int ig_lib_connection_batch (struct ig_lib_db *db, struct ig_lib_connection_spec *specs, int count)
+{
+    if (specs == NULL) return 0;
 
-    log_debug ("LConn", "processing hierarchy tree...");
-    GList *gen_objs_res = ig_lib_htree_process_signal (db, hier_tree);
+    int         failed      = 0;
+    GHashTable *batch_names = g_hash_table_new (g_str_hash, g_str_equal);
 
-    if (gen_objs_res != NULL) {
-        log_info ("LConn", "successfully created signal %s", signame);
-    } else {
-        log_warn ("LConn", "nothing created for signal %s", signame);
-        result = false;
-    }
+    /* check all names before anything is created */
+    for (int i = 0; i < count; i++) {
+        struct ig_lib_connection_spec *spec = &specs[i];
 
-    struct ig_net *net = ig_lib_add_net (db, signame, gen_objs_res);
+        spec->net   = NULL;
+        spec->error = NULL;
 
-    if (gen_net != NULL) {
-        *gen_net = net;
+        if (g_hash_table_contains (db->nets_by_name, spec->signame)) {
+            spec->error = "signal already exists";
+        } else if (g_hash_table_contains (batch_names, spec->signame)) {
+            spec->error = "signal specified more than once";
+        } else {
+            g_hash_table_insert (batch_names, (gpointer)spec->signame, (gpointer)spec->signame);
+        }
     }
+    g_hash_table_destroy (batch_names);
 
-    g_list_free (gen_objs_res);
+    log_debug ("LConB", "creating %d signals...", count);
+    for (int i = 0; i < count; i++) {
+        struct ig_lib_connection_spec *spec = &specs[i];
 
-    log_debug ("LConn", "deleting hierarchy tree...");
-    ig_lib_htree_free (hier_tree);
+        if (spec->error == NULL) {
+            bool   error           = false;
+            GList *hier_start_list = ig_lib_connection_hierarchies (db, spec->source, spec->targets, &error);
+            if (error) {
+                spec->error = "invalid endpoint hierarchy";
+            } else {
+                ig_lib_connection_create (db, spec->signame, hier_start_list, &spec->net, &spec->error);
+            }
+            ig_lib_hierarchy_list_free (hier_start_list);
+        } else {
+            ig_lib_connection_info_free (spec->source);
+            for (GList *li = spec->targets; li != NULL; li = li->next) {
+                ig_lib_connection_info_free ((struct ig_lib_connection_info *)li->data);
+            }
+            g_list_free (spec->targets);
+        }
 
-l_ig_lib_connection_final_free_hierlist:
-    for (GList *li = hier_start_list; li != NULL; li = li->next) {
-        GList *hier = (GList *)li->data;
-        for (GList *lj = hier; lj != NULL; lj = lj->next) {
-            struct ig_lib_connection_info *cinfo = (struct ig_lib_connection_info *)lj->data;
-            ig_lib_connection_info_free (cinfo);
+        if (spec->error != NULL) {
+            log_error ("LConB", "signal %s: %s", spec->signame, spec->error);
+            spec->net = NULL;
+            failed++;
         }
-        g_list_free (hier);
+
+        /* freed above */
+        spec->source  = NULL;
+        spec->targets = NULL;
     }
-    g_list_free (hier_start_list);
+    log_debug ("LConB", "... %d of %d signals failed", failed, count);
 
-    log_debug ("LConn", "finished...");
-    return result;
+    return failed;
 }
 
 bool ig_lib_parameter (struct ig_lib_db *db, const char *parname, const char *defvalue, GList *targets, struct ig_generic **gen_generic)
@@ -615,6 +647,19 @@ l_ig_lib_parameter_final_free_hierlist:
 }
 
 
+/* grouping of successor hierarchies with the same object while merging */
+struct ig_lib_merge_obj_groups {
+    GQueue     *first;   /* group of first successor - takes all unnamed successors */
+    bool        unnamed; /* first successor has no local name - all successors join first group */
+    GHashTable *named;   /* local name -> group (GQueue *) */
+};
+
+static void ig_lib_merge_obj_groups_free (struct ig_lib_merge_obj_groups *og)
+{
+    g_hash_table_destroy (og->named);
+    g_slice_free (struct ig_lib_merge_obj_groups, og);
+}
+
 static GNode *ig_lib_merge_hierarchy_list (struct ig_lib_db *db, GList *hier_list, const char *signame)
 {
     if (db == NULL) return NULL;
@@ -689,51 +734,171 @@ static GNode *ig_lib_merge_hierarchy_list (struct ig_lib_db *db, GList *hier_lis
         local_default_name = ig_lib_rm_suffix_pinport (db, local_default_name);
     }
 
-    /* generate children */
-    while (successor_list != NULL) {
-        /* pick one */
-        GList                         *equal_list    = successor_list;
-        GList                         *ref_hier_list = (GList *)equal_list->data;
-        struct ig_lib_connection_info *ref_cinfo     = (struct ig_lib_connection_info *)ref_hier_list->data;
-        log_debug ("LMrHi", "current node: %s", ref_cinfo->obj->id);
-
-        successor_list = g_list_remove_link (successor_list, equal_list);
-
-        GList *li = successor_list;
-        while (li != NULL) {
-            GList                         *i_hier_list = (GList *)li->data;
-            struct ig_lib_connection_info *i_cinfo     = (struct ig_lib_connection_info *)i_hier_list->data;
-
-            if (i_cinfo->obj != ref_cinfo->obj) {
-                li = li->next;
-                continue;
-            }
-            /* don't merge different names */
-            if ((i_cinfo->local_name != NULL) && (ref_cinfo->local_name != NULL)) {
-                if (strcmp (i_cinfo->local_name, ref_cinfo->local_name) != 0) {
-                    li = li->next;
-                    continue;
-                }
+    /* group successors: equal object and compatible local name */
+    GList      *groups     = NULL;
+    GHashTable *obj_groups = g_hash_table_new_full (g_direct_hash, g_direct_equal, NULL, (GDestroyNotify)ig_lib_merge_obj_groups_free);
+
+    for (GList *li = successor_list; li != NULL; li = li->next) {
+        GList                          *i_hier_list = (GList *)li->data;
+        struct ig_lib_connection_info  *i_cinfo     = (struct ig_lib_connection_info *)i_hier_list->data;
+        struct ig_lib_merge_obj_groups *og          = g_hash_table_lookup (obj_groups, i_cinfo->obj);
+        GQueue                         *group       = NULL;
+
+        if (og == NULL) {
+            log_debug ("LMrHi", "current node: %s", i_cinfo->obj->id);
+            og = g_slice_new (struct ig_lib_merge_obj_groups);
+
+            og->first   = g_queue_new ();
+            og->unnamed = (i_cinfo->local_name == NULL);
+            og->named   = g_hash_table_new (g_str_hash, g_str_equal);
+            if (!og->unnamed) {
+                g_hash_table_insert (og->named, (gpointer)i_cinfo->local_name, og->first);
             }
+            g_hash_table_insert (obj_groups, i_cinfo->obj, og);
 
-            /* part of equal list */
-            GList *li_next = li->next;
-            successor_list = g_list_remove_link (successor_list, li);
-            equal_list     = g_list_concat (equal_list, li);
-            li             = li_next;
+            groups = g_list_prepend (groups, og->first);
+            group  = og->first;
+        } else if (og->unnamed || (i_cinfo->local_name == NULL)) {
+            /* unnamed elements merge with anything */
+            group = og->first;
+        } else {
+            group = g_hash_table_lookup (og->named, i_cinfo->local_name);
+            if (group == NULL) {
+                group = g_queue_new ();
+                g_hash_table_insert (og->named, (gpointer)i_cinfo->local_name, group);
+                groups = g_list_prepend (groups, group);
+            }
         }
 
-        GNode *child_node = ig_lib_merge_hierarchy_list (db, equal_list, local_default_name);
+        g_queue_push_tail (group, i_hier_list);
+    }
+
+    g_hash_table_destroy (obj_groups);
+    g_list_free (successor_list);
+
+    /* generate children */
+    groups = g_list_reverse (groups);
+    for (GList *li = groups; li != NULL; li = li->next) {
+        GQueue *equal_list = (GQueue *)li->data;
+
+        GNode *child_node = ig_lib_merge_hierarchy_list (db, equal_list->head, local_default_name);
 
         child_node = g_node_insert (result, 0, child_node);
 
-        g_list_free (equal_list);
+        g_queue_free (equal_list);
     }
+    g_list_free (groups);
 
     return result;
 }
 
 
+/* hierarchy lists of all signal endpoints, frees targets list - error is set if any hierarchy could not be created */
+static GList *ig_lib_connection_hierarchies (struct ig_lib_db *db, struct ig_lib_connection_info *source, GList *targets, bool *error)
+{
+    GList *hier_start_list = NULL;
+
+    log_debug ("LConn", "creating individual hierarchies...");
+
+    if (source != NULL) {
+        source->dir         = IG_LCDIR_UP;
+        source->is_explicit = true;
+        log_debug ("LConn", "creating startpoint hierarchy...");
+        GList *source_hier = ig_lib_gen_hierarchy (db, source);
+        if (source_hier == NULL) {
+            *error = true;
+        } else {
+            hier_start_list = g_list_prepend (hier_start_list, source_hier);
+        }
+        log_debug ("LConn", "startpoint hierarchy depth: %d", g_list_length (source_hier));
+    }
+
+    for (GList *li = targets; li != NULL; li = li->next) {
+        struct ig_lib_connection_info *start = (struct ig_lib_connection_info *)li->data;
+        start->is_explicit = true;
+
+        log_debug ("LConn", "creating targetpoint hierarchy...");
+        GList *target_hier = ig_lib_gen_hierarchy (db, start);
+        if (target_hier == NULL) {
+            *error = true;
+        } else {
+            hier_start_list = g_list_prepend (hier_start_list, target_hier);
+        }
+        log_debug ("LConn", "targetpoint hierarchy depth: %d", g_list_length (target_hier));
+    }
+
+    g_list_free (targets);
+
+    return hier_start_list;
+}
+
+/* create signal net from endpoint hierarchies - errmsg is set to a static description on failure */
+static bool ig_lib_connection_create (struct ig_lib_db *db, const char *signame, GList *hier_start_list, struct ig_net **gen_net, const char **errmsg)
+{
+    log_debug ("LConn", "merging to hierarchy tree...");
+    /* create hierarchy tree */
+    GNode *hier_tree = ig_lib_merge_hierarchy_list (db, hier_start_list, signame);
+
+    if (hier_tree == NULL) {
+        *errmsg = "unable to merge endpoint hierarchies";
+        return false;
+    }
+
+    log_debug ("LConn", "printing hierarchy tree...");
+    /* debug: printout */
+    ig_lib_htree_print (hier_tree);
+
+    log_debug ("LConn", "reducing hierarchy tree...");
+    hier_tree = ig_lib_htree_reduce (hier_tree);
+    if (hier_tree == NULL) {
+        log_warn ("LConn", "Unable to create signal %s, because of insufficient hierarchy information.", signame);
+        *errmsg = "insufficient hierarchy information";
+        return false;
+    }
+
+    ig_lib_htree_print (hier_tree);
+
+    bool result = true;
+
+    log_debug ("LConn", "processing hierarchy tree...");
+    GList *gen_objs_res = ig_lib_htree_process_signal (db, hier_tree);
+
+    if (gen_objs_res != NULL) {
+        log_info ("LConn", "successfully created signal %s", signame);
+    } else {
+        log_warn ("LConn", "nothing created for signal %s", signame);
+        *errmsg = "nothing created";
+        result  = false;
+    }
+
+    struct ig_net *net = ig_lib_add_net (db, signame, gen_objs_res);
+
+    if (gen_net != NULL) {
+        *gen_net = net;
+    }
+
+    g_list_free (gen_objs_res);
+
+    log_debug ("LConn", "deleting hierarchy tree...");
+    ig_lib_htree_free (hier_tree);
+
+    return result;
+}
+
+/* free list of hierarchy lists */
+static void ig_lib_hierarchy_list_free (GList *hier_start_list)
+{
+    for (GList *li = hier_start_list; li != NULL; li = li->next) {
+        GList *hier = (GList *)li->data;
+        for (GList *lj = hier; lj != NULL; lj = lj->next) {
+            struct ig_lib_connection_info *cinfo = (struct ig_lib_connection_info *)lj->data;
+            ig_lib_connection_info_free (cinfo);
+        }
+        g_list_free (hier);
+    }
+    g_list_free (hier_start_list);
+}
+
 static GList *ig_lib_gen_hierarchy (struct ig_lib_db *db, struct ig_lib_connection_info *cinfo)
 {
     GList *result = NULL;
@@ -787,7 +952,9 @@ static GList *ig_lib_gen_hierarchy (struct ig_lib_db *db, struct ig_lib_connecti
                 cinfo->invert     = invert;
                 copy_first        = false;
             } else {
-                cinfo = ig_lib_connection_info_new (db->str_chunks, IG_OBJECT (mod->default_instance), NULL, cinfo->dir);
+                /* remaining hierarchy is independent of endpoint */
+                GList *root_path = ig_lib_root_path (db, mod->default_instance, cinfo->dir);
+                return g_list_concat (g_list_copy (root_path), result);
             }
             continue;
         } else {
@@ -802,6 +969,68 @@ static GList *ig_lib_gen_hierarchy (struct ig_lib_db *db, struct ig_lib_connecti
     }
 }
 
+/* cached hierarchy paths of an instance, one per signal direction */
+struct ig_lib_root_path {
+    GList *path[IG_LCDIR_DEFAULT + 1]; /* root first, ending with instance - list data: shared (struct ig_lib_connection_info *) */
+    GList *owned;                      /* connection info data created for this instance */
+};
+
+/* hierarchy path from inst to root as generated by ig_lib_gen_hierarchy - shared, must not be modified */
+static GList *ig_lib_root_path (struct ig_lib_db *db, struct ig_instance *inst, enum ig_lib_connection_dir dir)
+{
+    struct ig_lib_root_path *rp = g_hash_table_lookup (db->root_paths, inst);
+
+    if (rp == NULL) {
+        rp = g_slice_new0 (struct ig_lib_root_path);
+        g_hash_table_insert (db->root_paths, inst, rp);
+    } else if (rp->path[dir] != NULL) {
+        return rp->path[dir];
+    }
+
+    log_debug ("LRtPa", "creating root path of %s", IG_OBJECT (inst)->id);
+
+    GList                         *result     = NULL;
+    struct ig_lib_connection_info *inst_cinfo = ig_lib_connection_info_new (db->str_chunks, IG_OBJECT (inst), NULL, dir);
+
+    inst_cinfo->shared = true;
+    rp->owned          = g_list_prepend (rp->owned, inst_cinfo);
+
+    if (inst->parent != NULL) {
+        struct ig_module              *mod       = inst->parent;
+        struct ig_lib_connection_info *mod_cinfo = ig_lib_connection_info_new (db->str_chunks, IG_OBJECT (mod), NULL, dir);
+
+        mod_cinfo->shared = true;
+        rp->owned         = g_list_prepend (rp->owned, mod_cinfo);
+
+        if (mod->default_instance != NULL) {
+            result = g_list_copy (ig_lib_root_path (db, mod->default_instance, dir));
+        }
+        result = g_list_append (result, mod_cinfo);
+    }
+    result = g_list_append (result, inst_cinfo);
+
+    rp->path[dir] = result;
+
+    return result;
+}
+
+static void ig_lib_root_path_free (gpointer data)
+{
+    struct ig_lib_root_path *rp = (struct ig_lib_root_path *)data;
+
+    for (int i = 0; i <= IG_LCDIR_DEFAULT; i++) {
+        g_list_free (rp->path[i]);
+    }
+    for (GList *li = rp->owned; li != NULL; li = li->next) {
+        struct ig_lib_connection_info *cinfo = (struct ig_lib_connection_info *)li->data;
+        cinfo->shared = false;
+        ig_lib_connection_info_free (cinfo);
+    }
+    g_list_free (rp->owned);
+
+    g_slice_free (struct ig_lib_root_path, rp);
+}
+
 struct ig_lib_connection_info *ig_lib_connection_info_new (GStringChunk *str_chunks, struct ig_object *obj, const char *local_name, enum ig_lib_connection_dir dir)
 {
     if (obj == NULL) return NULL;
@@ -818,6 +1047,7 @@ struct ig_lib_connection_info *ig_lib_connection_info_new (GStringChunk *str_chu
     result->is_explicit = false;
     result->force_name  = false;
     result->invert      = false;
+    result->shared      = false;
 
     if (local_name == NULL) {
         result->local_name = NULL;
@@ -846,6 +1076,7 @@ struct ig_lib_connection_info *ig_lib_connection_info_copy (GStringChunk *str_ch
     result->is_explicit = original->is_explicit;
     result->force_name  = original->force_name;
     result->invert      = original->invert;
+    result->shared      = false;
 
     if (original->local_name != NULL) {
         result->local_name = g_string_chunk_insert_const (str_chunks, original->local_name);
@@ -865,6 +1096,7 @@ struct ig_lib_connection_info *ig_lib_connection_info_copy (GStringChunk *str_ch
 void ig_lib_connection_info_free (struct ig_lib_connection_info *cinfo)
 {
     if (cinfo == NULL) return;
+    if (cinfo->shared) return;
     g_slice_free (struct ig_lib_connection_info, cinfo);
 
 #ifdef DEBUG_IG_MMAN
@@ -874,6 +1106,9 @@ void ig_lib_connection_info_free (struct ig_lib_connection_info *cinfo)
 
 static void ig_lib_htree_print (GNode *hier_tree)
 {
+    /* debug output only */
+    if (!log_enabled (LOGLEVEL_DEBUG, "HTree") && !log_enabled (LOGLEVEL_DEBUG, "LPHTr")) return;
+
     GList *pr_stack  = NULL;
     int    pr_indent = 0;
 
@@ -1057,15 +1292,15 @@ static gboolean ig_lib_htree_process_signal_tfunc (GNode *node, gpointer data)
             }
 
             /* create a declaration */
-            struct ig_decl *mod_decl = ig_decl_new (signal_name, mod, db->str_chunks);
-            if (g_hash_table_contains (db->objects_by_id, IG_OBJECT (mod_decl)->id)) {
-                log_error ("HTrPS", "Already declared declaration %s", IG_OBJECT (mod_decl)->id);
-                ig_decl_free (mod_decl);
+            struct ig_object *existing = ig_obj_child_by_name (IG_OBJECT (mod), mod->decls, signal_name);
+            if (existing != NULL) {
+                log_error ("HTrPS", "Already declared declaration %s", existing->id);
                 pdata->error = true;
             } else {
-                g_hash_table_insert (db->objects_by_id, g_string_chunk_insert_const (db->str_chunks, IG_OBJECT (mod_decl)->id), IG_OBJECT (mod_decl));
+                struct ig_decl *mod_decl = ig_decl_new (signal_name, mod, db->str_chunks, db->arena);
+                ig_lib_db_register_object (db, g_string_chunk_insert_const (db->str_chunks, IG_OBJECT (mod_decl)->id), IG_OBJECT (mod_decl));
                 ig_obj_ref (IG_OBJECT (mod_decl));
-                g_queue_push_tail (mod->decls, mod_decl);
+                ig_obj_queue_push_tail (IG_OBJECT (mod), mod->decls, mod_decl);
                 ig_obj_ref (IG_OBJECT (mod_decl));
                 pdata->gen_objs = g_list_prepend (pdata->gen_objs, IG_OBJECT (mod_decl));
                 log_debug ("HTrPS", "Created declaration \"%s\" in module \"%s\"", signal_name, IG_OBJECT (mod)->id);
@@ -1156,15 +1391,15 @@ static gboolean ig_lib_htree_process_parameter_tfunc (GNode *node, gpointer data
         const char *par_name = local_name;
 
         /* create an adjustment */
-        struct ig_adjustment *inst_adj = ig_adjustment_new (par_name, adj_name, inst, db->str_chunks);
-        if (g_hash_table_contains (db->objects_by_id, IG_OBJECT (inst_adj)->id)) {
-            log_error ("HTrPP", "Already declared parameter adjustment %s", IG_OBJECT (inst_adj)->id);
-            ig_adjustment_free (inst_adj);
+        struct ig_object *existing = ig_obj_child_by_name (IG_OBJECT (inst), inst->adjustments, par_name);
+        if (existing != NULL) {
+            log_error ("HTrPP", "Already declared parameter adjustment %s", existing->id);
             pdata->error = true;
         } else {
-            g_hash_table_insert (db->objects_by_id, g_string_chunk_insert_const (db->str_chunks, IG_OBJECT (inst_adj)->id), IG_OBJECT (inst_adj));
+            struct ig_adjustment *inst_adj = ig_adjustment_new (par_name, adj_name, inst, db->str_chunks, db->arena);
+            ig_lib_db_register_object (db, g_string_chunk_insert_const (db->str_chunks, IG_OBJECT (inst_adj)->id), IG_OBJECT (inst_adj));
             ig_obj_ref (IG_OBJECT (inst_adj));
-            g_queue_push_tail (inst->adjustments, inst_adj);
+            ig_obj_queue_push_tail (IG_OBJECT (inst), inst->adjustments, inst_adj);
             ig_obj_ref (IG_OBJECT (inst_adj));
             pdata->gen_objs = g_list_prepend (pdata->gen_objs, IG_OBJECT (inst_adj));
             log_debug ("HTrPP", "Created adjustment of parameter \"%s\" in instance \"%s\" to value \"%s\"", par_name, IG_OBJECT (inst)->id, adj_name);
@@ -1182,15 +1417,15 @@ static gboolean ig_lib_htree_process_parameter_tfunc (GNode *node, gpointer data
             par_name = local_name;
 
             /* create a local parameter */
-            struct ig_param *mod_param = ig_param_new (par_name, defvalue, true, mod, db->str_chunks);
-            if (g_hash_table_contains (db->objects_by_id, IG_OBJECT (mod_param)->id)) {
-                log_error ("HTrPP", "Already declared parameter %s", IG_OBJECT (mod_param)->id);
-                ig_param_free (mod_param);
+            struct ig_object *existing = ig_obj_child_by_name (IG_OBJECT (mod), mod->params, par_name);
+            if (existing != NULL) {
+                log_error ("HTrPP", "Already declared parameter %s", existing->id);
                 pdata->error = true;
             } else {
-                g_hash_table_insert (db->objects_by_id, g_string_chunk_insert_const (db->str_chunks, IG_OBJECT (mod_param)->id), IG_OBJECT (mod_param));
+                struct ig_param *mod_param = ig_param_new (par_name, defvalue, true, mod, db->str_chunks, db->arena);
+                ig_lib_db_register_object (db, g_string_chunk_insert_const (db->str_chunks, IG_OBJECT (mod_param)->id), IG_OBJECT (mod_param));
                 ig_obj_ref (IG_OBJECT (mod_param));
-                g_queue_push_tail (mod->params, mod_param);
+                ig_obj_queue_push_tail (IG_OBJECT (mod), mod->params, mod_param);
                 ig_obj_ref (IG_OBJECT (mod_param));
                 pdata->gen_objs = g_list_prepend (pdata->gen_objs, IG_OBJECT (mod_param));
                 log_debug ("HTrPP", "Created local parameter \"%s\" in module \"%s\"", par_name, IG_OBJECT (mod)->id);
@@ -1207,15 +1442,15 @@ static gboolean ig_lib_htree_process_parameter_tfunc (GNode *node, gpointer data
             }
 
             /* create a parameter */
-            struct ig_param *mod_param = ig_param_new (par_name, defvalue, false, mod, db->str_chunks);
-            if (g_hash_table_contains (db->objects_by_id, IG_OBJECT (mod_param)->id)) {
-                log_error ("HTrPP", "Already declared parameter %s", IG_OBJECT (mod_param)->id);
-                ig_param_free (mod_param);
+            struct ig_object *existing = ig_obj_child_by_name (IG_OBJECT (mod), mod->params, par_name);
+            if (existing != NULL) {
+                log_error ("HTrPP", "Already declared parameter %s", existing->id);
                 pdata->error = true;
             } else {
-                g_hash_table_insert (db->objects_by_id, g_string_chunk_insert_const (db->str_chunks, IG_OBJECT (mod_param)->id), IG_OBJECT (mod_param));
+                struct ig_param *mod_param = ig_param_new (par_name, defvalue, false, mod, db->str_chunks, db->arena);
+                ig_lib_db_register_object (db, g_string_chunk_insert_const (db->str_chunks, IG_OBJECT (mod_param)->id), IG_OBJECT (mod_param));
                 ig_obj_ref (IG_OBJECT (mod_param));
-                g_queue_push_tail (mod->params, mod_param);
+                ig_obj_queue_push_tail (IG_OBJECT (mod), mod->params, mod_param);
                 ig_obj_ref (IG_OBJECT (mod_param));
                 pdata->gen_objs = g_list_prepend (pdata->gen_objs, IG_OBJECT (mod_param));
                 log_debug ("HTrPP", "Created parameter \"%s\" in module \"%s\"", par_name, IG_OBJECT (mod)->id);
@@ -1255,24 +1490,26 @@ static struct ig_net *ig_lib_add_net (struct ig_lib_db *db, const char *name, GL
     if (db == NULL) return NULL;
     if (name == NULL) return NULL;
 
-    struct ig_net *net = ig_net_new (name, db->str_chunks);
+    struct ig_net *net = ig_net_new (name, db->str_chunks, db->arena);
 
     if (net == NULL) return NULL;
 
     for (GList *li = objs; li != NULL; li = li->next) {
         struct ig_object *obj = PTR_TO_IG_OBJECT (li->data);
-        ig_obj_attr_set (obj, "signal",  name,                true);
-        ig_obj_attr_set (obj, "net",     name,                true);
-        ig_obj_attr_set (obj, "netid",   IG_OBJECT (net)->id, true);
+        ig_obj_attr_set_by_key (obj, IG_AK_SIGNAL, name,                true);
+        ig_obj_attr_set_by_key (obj, IG_AK_NET,    name,                true);
+        ig_obj_attr_set_by_key (obj, IG_AK_NETID,  IG_OBJECT (net)->id, true);
 
         struct ig_net **obj_net_ptr = NULL;
 
         if (obj->type == IG_OBJ_PORT) {
             obj_net_ptr = &(IG_PORT (obj)->net);
+            ig_module_local_name_add (IG_PORT (obj)->parent, ig_obj_attr_get_by_key (obj, IG_AK_SIGNAL), obj);
         } else if (obj->type == IG_OBJ_PIN) {
             obj_net_ptr = &(IG_PIN (obj)->net);
         } else if (obj->type == IG_OBJ_DECLARATION) {
             obj_net_ptr = &(IG_DECL (obj)->net);
+            ig_module_local_name_add (IG_DECL (obj)->parent, ig_obj_attr_get_by_key (obj, IG_AK_SIGNAL), obj);
         } else {
             log_errorint ("LNtAd", "Net %s contains object of invalid type %s.", IG_OBJECT (net)->name, ig_obj_type_name (obj->type));
         }
@@ -1282,7 +1519,7 @@ static struct ig_net *ig_lib_add_net (struct ig_lib_db *db, const char *name, GL
         }
 
         ig_obj_ref (obj);
-        g_queue_push_tail (net->objects, obj);
+        ig_obj_queue_push_tail (IG_OBJECT (net), net->objects, obj);
     }
 
     char *l_name = g_string_chunk_insert_const (db->str_chunks, IG_OBJECT (net)->name);
@@ -1290,7 +1527,7 @@ static struct ig_net *ig_lib_add_net (struct ig_lib_db *db, const char *name, GL
 
     g_hash_table_insert (db->nets_by_name,  l_name, IG_OBJECT (net));
     g_hash_table_insert (db->nets_by_id,    l_id,   IG_OBJECT (net));
-    g_hash_table_insert (db->objects_by_id, l_id,   IG_OBJECT (net));
+    ig_lib_db_register_object (db, l_id, IG_OBJECT (net));
     ig_obj_ref (IG_OBJECT (net));
     ig_obj_ref (IG_OBJECT (net));
     ig_obj_ref (IG_OBJECT (net));
@@ -1303,20 +1540,21 @@ static struct ig_generic *ig_lib_add_generic (struct ig_lib_db *db, const char *
     if (db == NULL) return NULL;
     if (name == NULL) return NULL;
 
-    struct ig_generic *generic = ig_generic_new (name, db->str_chunks);
+    struct ig_generic *generic = ig_generic_new (name, db->str_chunks, db->arena);
 
     if (generic == NULL) return NULL;
 
     for (GList *li = objs; li != NULL; li = li->next) {
         struct ig_object *obj = PTR_TO_IG_OBJECT (li->data);
-        ig_obj_attr_set (obj, "parameter",   name,                    true);
-        ig_obj_attr_set (obj, "generic",     name,                    true);
-        ig_obj_attr_set (obj, "genericid",   IG_OBJECT (generic)->id, true);
+        ig_obj_attr_set_by_key (obj, IG_AK_PARAMETER, name,                    true);
+        ig_obj_attr_set_by_key (obj, IG_AK_GENERIC,   name,                    true);
+        ig_obj_attr_set_by_key (obj, IG_AK_GENERICID, IG_OBJECT (generic)->id, true);
 
         struct ig_generic **obj_generic_ptr = NULL;
 
         if (obj->type == IG_OBJ_PARAMETER) {
             obj_generic_ptr = &(IG_PARAM (obj)->generic);
+            ig_module_local_name_add (IG_PARAM (obj)->parent, ig_obj_attr_get_by_key (obj, IG_AK_PARAMETER), obj);
         } else if (obj->type == IG_OBJ_ADJUSTMENT) {
             obj_generic_ptr = &(IG_ADJUSTMENT (obj)->generic);
         } else {
@@ -1328,7 +1566,7 @@ static struct ig_generic *ig_lib_add_generic (struct ig_lib_db *db, const char *
         }
 
         ig_obj_ref (obj);
-        g_queue_push_tail (generic->objects, obj);
+        ig_obj_queue_push_tail (IG_OBJECT (generic), generic->objects, obj);
     }
 
     char *l_name = g_string_chunk_insert_const (db->str_chunks, IG_OBJECT (generic)->name);
@@ -1336,7 +1574,7 @@ static struct ig_generic *ig_lib_add_generic (struct ig_lib_db *db, const char *
 
     g_hash_table_insert (db->generics_by_name, l_name, IG_OBJECT (generic));
     g_hash_table_insert (db->generics_by_id,   l_id,   IG_OBJECT (generic));
-    g_hash_table_insert (db->objects_by_id,    l_id,   IG_OBJECT (generic));
+    ig_lib_db_register_object (db, l_id, IG_OBJECT (generic));
     ig_obj_ref (IG_OBJECT (generic));
     ig_obj_ref (IG_OBJECT (generic));
     ig_obj_ref (IG_OBJECT (generic));
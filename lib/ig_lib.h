@@ -55,7 +55,14 @@ struct ig_lib_db {
     GHashTable *generics_by_name;  /**< @brief Mapping of generic names to generic object. Key: <tt> (const char *) </tt> -> value: <tt> (struct @ref ig_object *) </tt> */
     GHashTable *generics_by_id;    /**< @brief Mapping of Object-ID to generic object. Key: <tt> (const char *) </tt> -> value: <tt> (struct @ref ig_object *) </tt> */
 
+    guint32 last_seq;              /**< @brief Last creation sequence number assigned (see @ref ig_object::seq). */
+
+    GHashTable *root_paths;        /**< @brief Cached hierarchy paths from instances to the root, dropped when hierarchy changes. Key: <tt> (struct @ref ig_instance *) </tt> -> value: internal path data */
+
     GStringChunk *str_chunks;      /**< @brief String container used for all generated objects. */
+    struct ig_arena *arena;        /**< @brief Arena for generated objects or @c NULL if objects are refcounted (see @ref ig_lib_db_set_arena). */
+
+    unsigned long generation;      /**< @brief Database content generation, unique across databases and changed on every @ref ig_lib_db_clear. */
 };
 
 /**
@@ -81,6 +88,7 @@ struct ig_lib_connection_info {
     bool                       force_name;  /**< @brief Signal/parameter name must be kept verbatim. */
     enum ig_lib_connection_dir dir;         /**< @brief Signal direction in hierarchy.*/
     bool                       invert;      /**< @brief Signal: invert at this point. */
+    bool                       shared;      /**< @brief Part of a cached root path - immutable and not freed by @ref ig_lib_connection_info_free. */
 };
 
 /**
@@ -101,6 +109,17 @@ void ig_lib_db_clear (struct ig_lib_db *db);
  */
 void ig_lib_db_free (struct ig_lib_db *db);
 
+/**
+ * @brief Switch object allocation mode of database.
+ * @param db Database to modify.
+ * @param enable Allocate objects from an arena if true, use refcounted objects otherwise.
+ * @return false if the mode cannot be changed because the database is not empty.
+ *
+ * In arena mode objects are not refcounted and cannot be freed individually,
+ * @ref ig_lib_db_clear drops all of them at once.
+ */
+bool ig_lib_db_set_arena (struct ig_lib_db *db, bool enable);
+
 /**
  * @brief Add a new module to the database.
  * @param db Database to modify.
@@ -179,6 +198,17 @@ struct ig_rf_entry *ig_lib_add_regfile_entry (struct ig_lib_db *db, const char *
  */
 struct ig_rf_reg *ig_lib_add_regfile_reg   (struct ig_lib_db *db, const char *name, struct ig_rf_entry *parent);
 
+/**
+ * @brief Signal specification for @ref ig_lib_connection_batch.
+ */
+struct ig_lib_connection_spec {
+    const char                    *signame; /**< @brief Signal name. */
+    struct ig_lib_connection_info *source;  /**< @brief Signal source or @c NULL. Will be freed after usage. */
+    GList                         *targets; /**< @brief List of signal endpoints. List data: <tt> (struct @ref ig_lib_connection_info *) </tt>. Will be freed after usage. */
+    struct ig_net                 *net;     /**< @brief Output: Newly created net data or @c NULL on error. */
+    const char                    *error;   /**< @brief Output: Static description of the error or @c NULL on success. */
+};
+
 /**
  * @brief Create new connection info data.
  * @param str_chunks String container to use for newly created strings.
@@ -200,6 +230,8 @@ struct ig_lib_connection_info *ig_lib_connection_info_copy (GStringChunk *str_ch
 /**
  * @brief Free connection info data.
  * @param cinfo connection info data to free.
+ *
+ * Shared connection info data (see @ref ig_lib_connection_info::shared) is owned by the database and not freed.
  */
 void ig_lib_connection_info_free (struct ig_lib_connection_info *cinfo);
 
@@ -216,6 +248,21 @@ void ig_lib_connection_info_free (struct ig_lib_connection_info *cinfo);
  */
 bool ig_lib_connection (struct ig_lib_db *db, const char *signame, struct ig_lib_connection_info *source, GList *targets, struct ig_net **gen_net);
 
+/**
+ * @brief Create multiple hierarchical signals.
+ * @param db Database to use.
+ * @param specs Array of signal specifications.
+ * @param count Number of elements in @c specs.
+ * @return Number of signals that could not be created.
+ *
+ * Signal names are checked against existing signals and each other before any signal is created.
+ * The remaining signals are created in order in one pass as by @ref ig_lib_connection,
+ * hierarchy paths to the root are shared through the database cache (see @ref ig_lib_db::root_paths).
+ * An error of one signal does not affect the others. Source and targets of all specifications will be freed on return,
+ * @ref ig_lib_connection_spec::net and @ref ig_lib_connection_spec::error are set for each specification.
+ */
+int ig_lib_connection_batch (struct ig_lib_db *db, struct ig_lib_connection_spec *specs, int count);
+
 /**
  * @brief Create hierarchical parameter.
  * @param db Database to use.
@@ -25,7 +25,13 @@
 #include "ig_logo.h"
 
 #include <libgen.h>
+#include <stdlib.h>
 #include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/types.h>
+#include <sys/wait.h>
 
 #ifndef ICGLUE_LIB_NAMESPACE
 #define ICGLUE_LIB_NAMESPACE "ig::db::"
@@ -33,6 +39,12 @@
 #ifndef ICGLUE_LOG_NAMESPACE
 #define ICGLUE_LOG_NAMESPACE "ig::"
 #endif
+#ifndef ICGLUE_SYS_NAMESPACE
+#define ICGLUE_SYS_NAMESPACE "ig::sys::"
+#endif
+#ifndef ICGLUE_UTIL_NAMESPACE
+#define ICGLUE_UTIL_NAMESPACE "ig::util::"
+#endif
 
 /* TCLDOC
 ## @file ig_tcl.c
@@ -47,8 +59,25 @@
 
 /* Tcl helper function for parsing lists in GLists of char * */
 static int ig_tclc_tcl_string_list_parse (ClientData client_data, Tcl_Obj *obj, void *dest_ptr);
-
-static void ig_tclc_connection_parse (const char *input, GString *id, GString *net, bool *adapt, bool *inv);
+/* Tcl helper function for keeping argument as Tcl_Obj * */
+static int ig_tclc_tcl_obj_parse (ClientData client_data, Tcl_Obj *obj, void *dest_ptr);
+/* Tcl helper function for parsing lists in GLists of Tcl_Obj * */
+static int ig_tclc_tcl_obj_list_parse (ClientData client_data, Tcl_Obj *obj, void *dest_ptr);
+
+/* Tcl object references to database objects */
+static Tcl_Obj          *ig_tclc_objref_new        (struct ig_lib_db *db, struct ig_object *obj);
+static struct ig_object *ig_tclc_objref_get_cached (struct ig_lib_db *db, Tcl_Obj *ref);
+static struct ig_object *ig_tclc_objref_get        (struct ig_lib_db *db, Tcl_Obj *ref);
+
+/* command data of instance expression expansion */
+struct ig_tclc_expand_data;
+static struct ig_tclc_expand_data *ig_tclc_expand_data_new  (struct ig_lib_db *db);
+static void                        ig_tclc_expand_data_free (ClientData clientdata);
+
+static void              ig_tclc_connection_parse      (const char *input, GString *id, GString *net, bool *adapt, bool *inv);
+static struct ig_object *ig_tclc_connection_endpoint   (struct ig_lib_db *db, Tcl_Obj *input, GString *id, GString *net, bool *adapt, bool *inv, GHashTable *cache);
+static int               ig_tclc_connection_spec_parse (struct ig_lib_db *db, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[], struct ig_lib_connection_spec *spec, const char **size_out, GHashTable *cache);
+static void              ig_tclc_connection_set_size   (struct ig_net *net, const char *size);
 static void ig_tclc_check_name_and_warn (const char *name);
 
 /* tcl proc declarations */
@@ -58,16 +87,33 @@ static int ig_tclc_add_codesection    (ClientData clientdata, Tcl_Interp *interp
 static int ig_tclc_add_regfile        (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[]);
 static int ig_tclc_set_attribute      (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[]);
 static int ig_tclc_get_attribute      (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[]);
+static int ig_tclc_get_attributes_bulk (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[]);
+static int ig_tclc_get_local_names     (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[]);
+static int ig_tclc_expand_instances    (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[]);
 static int ig_tclc_get_objs_of_obj    (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[]);
 static int ig_tclc_get_netgen_objects (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[]);
 static int ig_tclc_connect            (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[]);
+static int ig_tclc_connect_batch      (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[]);
 static int ig_tclc_parameter          (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[]);
 static int ig_tclc_create_pin         (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[]);
+static int ig_tclc_get_regfile_arraylist (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[]);
 static int ig_tclc_reset              (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[]);
 static int ig_tclc_logger             (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[]);
 static int ig_tclc_log                (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[]);
 static int ig_tclc_log_stat           (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[]);
 static int ig_tclc_print_logo         (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[]);
+static int ig_tclc_extract_keep_blocks (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[]);
+static int ig_tclc_template_lex_icgt  (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[]);
+static int ig_tclc_template_lex_wtf   (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[]);
+static int ig_tclc_template_lexer_version (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[]);
+static int ig_tclc_adapt_code         (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[]);
+static int ig_tclc_parse_opts         (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[]);
+static int ig_tclc_interval_overlaps  (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[]);
+
+static int ig_tclc_fork               (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[]);
+static int ig_tclc_waitpid            (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[]);
+static int ig_tclc_redirect_stderr    (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[]);
+static int ig_tclc_mkdtemp            (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[]);
 
 static int tcl_error_msg (Tcl_Interp *interp, const char *format, ...) __attribute__((format (printf, 2, 0)));
 static int tcl_verror_msg (Tcl_Interp *interp, const char *format, va_list args);
@@ -75,12 +121,28 @@ static int tcl_verror_msg (Tcl_Interp *interp, const char *format, va_list args)
 static int tcl_dict_get_str (Tcl_Interp *interp, Tcl_Obj *tcl_dict, char *key, char **value);
 static int tcl_dict_get_int (Tcl_Interp *interp, Tcl_Obj *tcl_dict, char *key, int *value);
 
+/*
+ * Tcl_Obj type for object-ids:
+ * the string representation is the object-id and always kept valid,
+ * the internal representation caches the object (ptrAndLongRep.ptr)
+ * together with the database generation it was resolved in (ptrAndLongRep.value).
+ */
+static const Tcl_ObjType ig_tclc_objref_type = {
+    "ig_object", /* name */
+    NULL,        /* freeIntRepProc - nothing to free */
+    NULL,        /* dupIntRepProc - plain copy of internal rep */
+    NULL,        /* updateStringProc - string rep is never invalidated */
+    NULL         /* setFromAnyProc - conversion needs database, see ig_tclc_objref_get */
+};
+
 void ig_add_tcl_commands (Tcl_Interp *interp)
 {
     if (interp == NULL) return;
 
     struct ig_lib_db *lib_db = ig_lib_db_new ();
 
+    Tcl_RegisterObjType (&ig_tclc_objref_type);
+
     Tcl_Namespace *db_ns = Tcl_CreateNamespace (interp, ICGLUE_LIB_NAMESPACE, NULL, NULL);
 
     Tcl_CreateObjCommand (interp, ICGLUE_LIB_NAMESPACE "create_module",       ig_tclc_create_module,      lib_db, NULL);
@@ -89,6 +151,8 @@ void ig_add_tcl_commands (Tcl_Interp *interp)
     Tcl_CreateObjCommand (interp, ICGLUE_LIB_NAMESPACE "add_regfile",         ig_tclc_add_regfile,        lib_db, NULL);
     Tcl_CreateObjCommand (interp, ICGLUE_LIB_NAMESPACE "set_attribute",       ig_tclc_set_attribute,      lib_db, NULL);
     Tcl_CreateObjCommand (interp, ICGLUE_LIB_NAMESPACE "get_attribute",       ig_tclc_get_attribute,      lib_db, NULL);
+    Tcl_CreateObjCommand (interp, ICGLUE_LIB_NAMESPACE "get_attributes_bulk", ig_tclc_get_attributes_bulk, lib_db, NULL);
+    Tcl_CreateObjCommand (interp, ICGLUE_LIB_NAMESPACE "get_local_names",     ig_tclc_get_local_names,    lib_db, NULL);
     Tcl_CreateObjCommand (interp, ICGLUE_LIB_NAMESPACE "get_modules",         ig_tclc_get_objs_of_obj,    lib_db, NULL);
     Tcl_CreateObjCommand (interp, ICGLUE_LIB_NAMESPACE "get_instances",       ig_tclc_get_objs_of_obj,    lib_db, NULL);
     Tcl_CreateObjCommand (interp, ICGLUE_LIB_NAMESPACE "get_instantiation",   ig_tclc_get_objs_of_obj,    lib_db, NULL);
@@ -106,9 +170,12 @@ void ig_add_tcl_commands (Tcl_Interp *interp)
     Tcl_CreateObjCommand (interp, ICGLUE_LIB_NAMESPACE "get_net_objects",     ig_tclc_get_netgen_objects, lib_db, NULL);
     Tcl_CreateObjCommand (interp, ICGLUE_LIB_NAMESPACE "get_generic_objects", ig_tclc_get_netgen_objects, lib_db, NULL);
     Tcl_CreateObjCommand (interp, ICGLUE_LIB_NAMESPACE "connect",             ig_tclc_connect,            lib_db, NULL);
+    Tcl_CreateObjCommand (interp, ICGLUE_LIB_NAMESPACE "connect_batch",       ig_tclc_connect_batch,      lib_db, NULL);
     Tcl_CreateObjCommand (interp, ICGLUE_LIB_NAMESPACE "parameter",           ig_tclc_parameter,          lib_db, NULL);
     Tcl_CreateObjCommand (interp, ICGLUE_LIB_NAMESPACE "create_pin",          ig_tclc_create_pin,         lib_db, NULL);
+    Tcl_CreateObjCommand (interp, ICGLUE_LIB_NAMESPACE "get_regfile_arraylist", ig_tclc_get_regfile_arraylist, lib_db, NULL);
     Tcl_CreateObjCommand (interp, ICGLUE_LIB_NAMESPACE "reset",               ig_tclc_reset,              lib_db, NULL);
+    Tcl_CreateObjCommand (interp, ICGLUE_LIB_NAMESPACE "expand_instances",    ig_tclc_expand_instances,   ig_tclc_expand_data_new (lib_db), ig_tclc_expand_data_free);
     Tcl_Export (interp, db_ns, "*", true);
 
     Tcl_Namespace *log_ns = Tcl_CreateNamespace (interp, ICGLUE_LOG_NAMESPACE, NULL, NULL);
@@ -118,6 +185,25 @@ void ig_add_tcl_commands (Tcl_Interp *interp)
     Tcl_CreateObjCommand (interp, ICGLUE_LOG_NAMESPACE "log_stat",            ig_tclc_log_stat,           lib_db, NULL);
     Tcl_CreateObjCommand (interp, ICGLUE_LOG_NAMESPACE "print_logo",          ig_tclc_print_logo,         lib_db, NULL);
     Tcl_Export (interp, log_ns, "*", true);
+
+    Tcl_Namespace *util_ns = Tcl_CreateNamespace (interp, ICGLUE_UTIL_NAMESPACE, NULL, NULL);
+
+    Tcl_CreateObjCommand (interp, ICGLUE_UTIL_NAMESPACE "extract_keep_blocks",    ig_tclc_extract_keep_blocks,    lib_db, NULL);
+    Tcl_CreateObjCommand (interp, ICGLUE_UTIL_NAMESPACE "template_lex_icgt",      ig_tclc_template_lex_icgt,      lib_db, NULL);
+    Tcl_CreateObjCommand (interp, ICGLUE_UTIL_NAMESPACE "template_lex_wtf",       ig_tclc_template_lex_wtf,       lib_db, NULL);
+    Tcl_CreateObjCommand (interp, ICGLUE_UTIL_NAMESPACE "template_lexer_version", ig_tclc_template_lexer_version, lib_db, NULL);
+    Tcl_CreateObjCommand (interp, ICGLUE_UTIL_NAMESPACE "adapt_code",             ig_tclc_adapt_code,             lib_db, NULL);
+    Tcl_CreateObjCommand (interp, ICGLUE_UTIL_NAMESPACE "parse_opts",             ig_tclc_parse_opts,             lib_db, NULL);
+    Tcl_CreateObjCommand (interp, ICGLUE_UTIL_NAMESPACE "interval_overlaps",      ig_tclc_interval_overlaps,      lib_db, NULL);
+    Tcl_Export (interp, util_ns, "*", true);
+
+    Tcl_Namespace *sys_ns = Tcl_CreateNamespace (interp, ICGLUE_SYS_NAMESPACE, NULL, NULL);
+
+    Tcl_CreateObjCommand (interp, ICGLUE_SYS_NAMESPACE "fork",                ig_tclc_fork,               lib_db, NULL);
+    Tcl_CreateObjCommand (interp, ICGLUE_SYS_NAMESPACE "waitpid",             ig_tclc_waitpid,            lib_db, NULL);
+    Tcl_CreateObjCommand (interp, ICGLUE_SYS_NAMESPACE "redirect_stderr",     ig_tclc_redirect_stderr,    lib_db, NULL);
+    Tcl_CreateObjCommand (interp, ICGLUE_SYS_NAMESPACE "mkdtemp",             ig_tclc_mkdtemp,            lib_db, NULL);
+    Tcl_Export (interp, sys_ns, "*", true);
 }
 
 /* Tcl helper function for parsing lists in GLists */
@@ -162,6 +248,93 @@ static int ig_tclc_tcl_string_list_parse (ClientData client_data, Tcl_Obj *obj,
     return 1;
 }
 
+/* Tcl helper function for keeping argument as Tcl_Obj * */
+static int ig_tclc_tcl_obj_parse (ClientData client_data, Tcl_Obj *obj, void *dest_ptr)
+{
+    Tcl_Obj **obj_dest = (Tcl_Obj **)dest_ptr;
+
+    if ((dest_ptr == NULL) || (obj == NULL)) {
+        return 1;
+    }
+
+    *obj_dest = obj;
+    return 1;
+}
+
+/* Tcl helper function for parsing lists in GLists of Tcl_Obj * */
+static int ig_tclc_tcl_obj_list_parse (ClientData client_data, Tcl_Obj *obj, void *dest_ptr)
+{
+    GList **list_dest = (GList **)dest_ptr;
+
+    if ((dest_ptr == NULL) || (obj == NULL)) {
+        return 1;
+    }
+
+    int       len   = 0;
+    Tcl_Obj **elems = NULL;
+
+    if (Tcl_ListObjGetElements (NULL, obj, &len, &elems) != TCL_OK) return -1;
+
+    GList *result = NULL;
+    for (int i = len - 1; i >= 0; i--) {
+        result = g_list_prepend (result, elems[i]);
+    }
+
+    *list_dest = result;
+    return 1;
+}
+
+/*******************************************************
+ * object references
+ *******************************************************/
+
+static void ig_tclc_objref_set (struct ig_lib_db *db, Tcl_Obj *ref, struct ig_object *obj)
+{
+    if ((ref->typePtr != NULL) && (ref->typePtr->freeIntRepProc != NULL)) {
+        ref->typePtr->freeIntRepProc (ref);
+    }
+
+    ref->internalRep.ptrAndLongRep.ptr   = obj;
+    ref->internalRep.ptrAndLongRep.value = db->generation;
+    ref->typePtr                         = &ig_tclc_objref_type;
+}
+
+/* create Tcl_Obj with object-id of obj */
+static Tcl_Obj *ig_tclc_objref_new (struct ig_lib_db *db, struct ig_object *obj)
+{
+    Tcl_Obj *result = Tcl_NewStringObj (obj->id, -1);
+
+    ig_tclc_objref_set (db, result, obj);
+
+    return result;
+}
+
+/* cached object of ref if still valid or NULL - does not look at the string representation */
+static struct ig_object *ig_tclc_objref_get_cached (struct ig_lib_db *db, Tcl_Obj *ref)
+{
+    if (ref->typePtr != &ig_tclc_objref_type) return NULL;
+    if (ref->internalRep.ptrAndLongRep.value != db->generation) return NULL;
+
+    return PTR_TO_IG_OBJECT (ref->internalRep.ptrAndLongRep.ptr);
+}
+
+/* resolve object-id in ref and cache the result in ref */
+static struct ig_object *ig_tclc_objref_get (struct ig_lib_db *db, Tcl_Obj *ref)
+{
+    if (ref == NULL) return NULL;
+
+    struct ig_object *obj = ig_tclc_objref_get_cached (db, ref);
+    if (obj != NULL) return obj;
+
+    obj = PTR_TO_IG_OBJECT (g_hash_table_lookup (db->objects_by_id, Tcl_GetString (ref)));
+
+    if (obj != NULL) {
+        ig_tclc_objref_set (db, ref, obj);
+    }
+
+    return obj;
+}
+
 
 /* TCLDOC
 ##
@@ -215,7 +388,7 @@ static int ig_tclc_create_module (ClientData clientdata, Tcl_Interp *interp, int
         return tcl_error_msg (interp, "Unable to create module \"%s\"", name);
     }
 
-    Tcl_SetObjResult (interp, Tcl_NewStringObj (IG_OBJECT (module)->id, -1));
+    Tcl_SetObjResult (interp, ig_tclc_objref_new (db, IG_OBJECT (module)));
 
     return TCL_OK;
 }
@@ -274,7 +447,7 @@ static int ig_tclc_create_instance (ClientData clientdata, Tcl_Interp *interp, i
 
     if (inst == NULL) return tcl_error_msg (interp, "Unable to create instance \"%s\"", name);
 
-    Tcl_SetObjResult (interp, Tcl_NewStringObj (IG_OBJECT (inst)->id, -1));
+    Tcl_SetObjResult (interp, ig_tclc_objref_new (db, IG_OBJECT (inst)));
 
     return TCL_OK;
 }
@@ -324,7 +497,7 @@ static int ig_tclc_add_codesection (ClientData clientdata, Tcl_Interp *interp, i
     struct ig_code *cs = ig_lib_add_codesection (db, name, code, pa_mod);
 
     if (cs == NULL) return tcl_error_msg (interp, "Unable to create codesection for module \"%s\"", IG_OBJECT (pa_mod)->name);
-    Tcl_SetObjResult (interp, Tcl_NewStringObj (IG_OBJECT (cs)->id, -1));
+    Tcl_SetObjResult (interp, ig_tclc_objref_new (db, IG_OBJECT (cs)));
 
     return TCL_OK;
 }
@@ -428,13 +601,13 @@ static int ig_tclc_set_attribute (ClientData clientdata, Tcl_Interp *interp, int
 
     if (db == NULL) return tcl_error_msg (interp,  "Database is NULL");
 
-    char  *obj_name   = NULL;
-    char  *attr_name  = NULL;
-    char  *attr_value = NULL;
-    GList *attr_list  = NULL;
+    Tcl_Obj *obj_ref    = NULL;
+    char    *attr_name  = NULL;
+    char    *attr_value = NULL;
+    GList   *attr_list  = NULL;
 
     Tcl_ArgvInfo arg_table [] = {
-        {TCL_ARGV_STRING,   "-object",      NULL, (void *)&obj_name,   "object id", NULL},
+        {TCL_ARGV_FUNC,     "-object",      (void *)(Tcl_ArgvFuncProc *)ig_tclc_tcl_obj_parse, (void *)&obj_ref, "object id", NULL},
         {TCL_ARGV_STRING,   "-attribute",   NULL, (void *)&attr_name,  "attribute name", NULL},
         {TCL_ARGV_STRING,   "-value",       NULL, (void *)&attr_value, "attribute value", NULL},
 
@@ -448,7 +621,7 @@ static int ig_tclc_set_attribute (ClientData clientdata, Tcl_Interp *interp, int
 
     if (result != TCL_OK) return result;
 
-    if (obj_name == NULL) {
+    if (obj_ref == NULL) {
         g_list_free (attr_list);
         return tcl_error_msg (interp, "No object specified");
     }
@@ -462,7 +635,8 @@ static int ig_tclc_set_attribute (ClientData clientdata, Tcl_Interp *interp, int
         return tcl_error_msg (interp, "Single attribute without value");
     }
 
-    struct ig_object *obj = PTR_TO_IG_OBJECT (g_hash_table_lookup (db->objects_by_id, obj_name));
+    const char       *obj_name = Tcl_GetString (obj_ref);
+    struct ig_object *obj      = ig_tclc_objref_get (db, obj_ref);
 
     if (obj == NULL) {
         g_list_free (attr_list);
@@ -470,7 +644,7 @@ static int ig_tclc_set_attribute (ClientData clientdata, Tcl_Interp *interp, int
     }
 
     if (attr_name != NULL) {
-        if (!ig_obj_attr_set (obj, attr_name, attr_value, false)) {
+        if (!ig_obj_attr_set_by_key (obj, ig_attr_key_intern (attr_name), attr_value, false)) {
             return tcl_error_msg (interp, "Unable to set attribute \"%s\"(=\"%s\") for object \"%s\"", attr_name, attr_value, obj_name);
         }
 
@@ -511,15 +685,15 @@ static int ig_tclc_get_attribute (ClientData clientdata, Tcl_Interp *interp, int
     int int_true  = true;
     int int_false = false;
 
-    char  *obj_name        = NULL;
-    char  *attr_name       = NULL;
-    char  *defaultval      = NULL;
-    GList *attr_list       = NULL;
-    bool   print_attr_name = false;
-    int    check_exists    = int_false;
+    Tcl_Obj *obj_ref         = NULL;
+    char    *attr_name       = NULL;
+    char    *defaultval      = NULL;
+    GList   *attr_list       = NULL;
+    bool     print_attr_name = false;
+    int      check_exists    = int_false;
 
     Tcl_ArgvInfo arg_table [] = {
-        {TCL_ARGV_STRING,   "-object",      NULL, (void *)&obj_name,    "object id", NULL},
+        {TCL_ARGV_FUNC,     "-object",      (void *)(Tcl_ArgvFuncProc *)ig_tclc_tcl_obj_parse, (void *)&obj_ref, "object id", NULL},
         {TCL_ARGV_STRING,   "-attribute",   NULL, (void *)&attr_name,   "attribute name", NULL},
         {TCL_ARGV_STRING,   "-default",     NULL, (void *)&defaultval,  "default value for single attribute if attribute does not exist", NULL},
 
@@ -535,7 +709,7 @@ static int ig_tclc_get_attribute (ClientData clientdata, Tcl_Interp *interp, int
 
     if (result != TCL_OK) return result;
 
-    if (obj_name == NULL) {
+    if (obj_ref == NULL) {
         g_list_free (attr_list);
         return tcl_error_msg (interp, "No object specified");
     }
@@ -545,7 +719,8 @@ static int ig_tclc_get_attribute (ClientData clientdata, Tcl_Interp *interp, int
         return tcl_error_msg (interp, "Specifying single attribute and attribute list is not supported");
     }
 
-    struct ig_object *obj = PTR_TO_IG_OBJECT (g_hash_table_lookup (db->objects_by_id, obj_name));
+    const char       *obj_name = Tcl_GetString (obj_ref);
+    struct ig_object *obj      = ig_tclc_objref_get (db, obj_ref);
 
     if (obj == NULL) {
         g_list_free (attr_list);
@@ -557,7 +732,7 @@ static int ig_tclc_get_attribute (ClientData clientdata, Tcl_Interp *interp, int
     }
 
     if (attr_name != NULL) {
-        const char *val = ig_obj_attr_get (obj, attr_name);
+        const char *val = ig_obj_attr_get_by_key (obj, ig_attr_key_lookup (attr_name));
         if (check_exists) {
             Tcl_SetObjResult (interp, Tcl_NewBooleanObj (val != NULL));
             return TCL_OK;
@@ -579,7 +754,7 @@ static int ig_tclc_get_attribute (ClientData clientdata, Tcl_Interp *interp, int
     if (!check_exists) {
         for (GList *li = attr_list; li != NULL; li = li->next) {
             char *attr = (char *)li->data;
-            if (ig_obj_attr_get (obj, attr) == NULL) {
+            if (ig_obj_attr_get_by_key (obj, ig_attr_key_lookup (attr)) == NULL) {
                 g_list_free (attr_list);
                 return tcl_error_msg (interp, "Could not get attribute \"%s\" of object \"%s\"", attr, obj_name);
             }
@@ -591,7 +766,7 @@ static int ig_tclc_get_attribute (ClientData clientdata, Tcl_Interp *interp, int
 
     for (GList *li = attr_list; li != NULL; li = li->next) {
         char       *attr = (char *)li->data;
-        const char *val  = ig_obj_attr_get (obj, attr);
+        const char *val  = ig_obj_attr_get_by_key (obj, ig_attr_key_lookup (attr));
 
         Tcl_Obj *val_obj = NULL;
         if (check_exists) {
@@ -611,101 +786,134 @@ static int ig_tclc_get_attribute (ClientData clientdata, Tcl_Interp *interp, int
     return TCL_OK;
 }
 
-enum ig_tclc_get_objs_of_obj_version {
-    IG_TOOOV_INVALID,
-    IG_TOOOV_PINS,
-    IG_TOOOV_PORTS,
-    IG_TOOOV_DECLS,
-    IG_TOOOV_ADJ,
-    IG_TOOOV_PARAMS,
-    IG_TOOOV_CODE,
-    IG_TOOOV_MODULES,
-    IG_TOOOV_INSTANCES,
-    IG_TOOOV_INSTANTIATION,
-    IG_TOOOV_REGFILES,
-    IG_TOOOV_RF_ENTRIES,
-    IG_TOOOV_RF_REGS,
-    IG_TOOOV_NETS,
-    IG_TOOOV_GENERICS,
-};
-
-static enum ig_tclc_get_objs_of_obj_version ig_tclc_get_objs_of_obj_version_from_cmd (const char *cmdname)
+/* TCLDOC
+##
+# @brief Get values of attributes of multiple objects at once.
+#
+# @param args Parsed command arguments:<br>
+# -objects {\<object-id1\> \<object-id2\> ...}<br>
+# -attributes {\<name1\> {\<name2\> \<default2\>} ...}
+#
+# @return Flat list with the value of each attribute for each object (object-major order).
+#
+# An attribute can be given together with a default value, which is returned if the attribute does not exist.
+# Attributes without default value must exist for every object.
+# The result can be iterated in parallel to the object list, e.g.
+# <tt>foreach obj $objs {name size} [get_attributes_bulk -objects $objs -attributes {name size}] {...}</tt>.
+*/
+static int ig_tclc_get_attributes_bulk (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[])
 {
-    while (true) {
-        const char *cmdchomp = strstr (cmdname, "::");
-        if (cmdchomp == NULL) break;
-        cmdname = cmdchomp + 2;
+    struct ig_lib_db *db = (struct ig_lib_db *)clientdata;
+
+    if (db == NULL) return tcl_error_msg (interp,  "Database is NULL");
+
+    Tcl_Obj *objs_list  = NULL;
+    Tcl_Obj *attrs_list = NULL;
+
+    Tcl_ArgvInfo arg_table [] = {
+        {TCL_ARGV_FUNC, "-objects",    (void *)(Tcl_ArgvFuncProc *)ig_tclc_tcl_obj_parse, (void *)&objs_list,  "object ids as list", NULL},
+        {TCL_ARGV_FUNC, "-attributes", (void *)(Tcl_ArgvFuncProc *)ig_tclc_tcl_obj_parse, (void *)&attrs_list, "attributes as list of form <name1> {<name2> <default2>} ...", NULL},
+
+        TCL_ARGV_AUTO_HELP,
+        TCL_ARGV_TABLE_END
+    };
+
+    int result = Tcl_ParseArgsObjv (interp, arg_table, &objc, objv, NULL);
+
+    if (result != TCL_OK) return result;
+
+    if (objs_list == NULL)  return tcl_error_msg (interp, "No objects specified");
+    if (attrs_list == NULL) return tcl_error_msg (interp, "No attributes specified");
+
+    int       n_objs  = 0;
+    int       n_attrs = 0;
+    Tcl_Obj **objs    = NULL;
+    Tcl_Obj **attrs   = NULL;
+
+    if (Tcl_ListObjGetElements (interp, objs_list, &n_objs, &objs) != TCL_OK) return TCL_ERROR;
+    if (Tcl_ListObjGetElements (interp, attrs_list, &n_attrs, &attrs) != TCL_OK) return TCL_ERROR;
+
+    const char  **names    = g_new (const char *, n_attrs);
+    unsigned int *keys     = g_new (unsigned int, n_attrs);
+    Tcl_Obj     **defaults = g_new (Tcl_Obj *, n_attrs);
+    Tcl_Obj     **values   = g_new (Tcl_Obj *, (gsize)n_objs * n_attrs);
+    int           n_values = 0;
+
+    for (int i = 0; i < n_attrs; i++) {
+        int       len  = 0;
+        Tcl_Obj **spec = NULL;
+
+        if ((Tcl_ListObjGetElements (interp, attrs[i], &len, &spec) != TCL_OK) || (len < 1) || (len > 2)) {
+            result = tcl_error_msg (interp, "Invalid attribute specification \"%s\" - expected <name> or {<name> <default>}", Tcl_GetString (attrs[i]));
+            goto l_ig_tclc_get_attributes_bulk_exit;
+        }
+        names[i]    = Tcl_GetString (spec[0]);
+        keys[i]     = ig_attr_key_lookup (names[i]);
+        defaults[i] = (len == 2 ? spec[1] : NULL);
     }
-    enum ig_tclc_get_objs_of_obj_version version = IG_TOOOV_INVALID;
 
-    if (strcmp (cmdname, "get_ports") == 0) {
-        version = IG_TOOOV_PORTS;
-    } else if (strcmp (cmdname, "get_declarations") == 0) {
-        version = IG_TOOOV_DECLS;
-    } else if (strcmp (cmdname, "get_parameters") == 0) {
-        version = IG_TOOOV_PARAMS;
-    } else if (strcmp (cmdname, "get_codesections") == 0) {
-        version = IG_TOOOV_CODE;
-    } else if (strcmp (cmdname, "get_pins") == 0) {
-        version = IG_TOOOV_PINS;
-    } else if (strcmp (cmdname, "get_adjustments") == 0) {
-        version = IG_TOOOV_ADJ;
-    } else if (strcmp (cmdname, "get_modules") == 0) {
-        version = IG_TOOOV_MODULES;
-    } else if (strcmp (cmdname, "get_instances") == 0) {
-        version = IG_TOOOV_INSTANCES;
-    } else if (strcmp (cmdname, "get_instantiation") == 0) {
-        version = IG_TOOOV_INSTANTIATION;
-    } else if (strcmp (cmdname, "get_regfiles") == 0) {
-        version = IG_TOOOV_REGFILES;
-    } else if (strcmp (cmdname, "get_regfile_entries") == 0) {
-        version = IG_TOOOV_RF_ENTRIES;
-    } else if (strcmp (cmdname, "get_regfile_regs") == 0) {
-        version = IG_TOOOV_RF_REGS;
-    } else if (strcmp (cmdname, "get_nets") == 0) {
-        version = IG_TOOOV_NETS;
-    } else if (strcmp (cmdname, "get_generics") == 0) {
-        version = IG_TOOOV_GENERICS;
+    for (int i = 0; i < n_objs; i++) {
+        struct ig_object *obj = ig_tclc_objref_get (db, objs[i]);
+
+        if (obj == NULL) {
+            result = tcl_error_msg (interp, "Unknown object \"%s\"", Tcl_GetString (objs[i]));
+            goto l_ig_tclc_get_attributes_bulk_exit;
+        }
+
+        for (int j = 0; j < n_attrs; j++) {
+            const char *val = ig_obj_attr_get_by_key (obj, keys[j]);
+
+            if (val != NULL) {
+                values[n_values++] = Tcl_NewStringObj (val, -1);
+            } else if (defaults[j] != NULL) {
+                values[n_values++] = defaults[j];
+            } else {
+                result = tcl_error_msg (interp, "Could not get attribute \"%s\" of object \"%s\"", names[j], obj->id);
+                goto l_ig_tclc_get_attributes_bulk_exit;
+            }
+        }
     }
 
-    return version;
+    Tcl_SetObjResult (interp, Tcl_NewListObj (n_values, values));
+    n_values = 0;
+
+l_ig_tclc_get_attributes_bulk_exit:
+    /* free values not taken over by a result list */
+    for (int i = 0; i < n_values; i++) {
+        Tcl_IncrRefCount (values[i]);
+        Tcl_DecrRefCount (values[i]);
+    }
+    g_free (names);
+    g_free (keys);
+    g_free (defaults);
+    g_free (values);
+
+    return result;
 }
 
 /* TCLDOC
 ##
-# @brief Return child object(s) of given parent.
+# @brief Get replacement map of net and generic names to local names of a module.
 #
 # @param args Parsed command arguments:<br>
-# (-name \<child-name\><br>
-# |-all)<br>
-# -of \<parent-object-id\>
+# -of \<module-id\>
 #
-# @return Object-ID(s) of child object(s) or an error
+# @return Dict mapping the names of nets and generics connected to the module
+# to the names of the corresponding local ports, declarations and parameters.
+#
+# The map is maintained while connecting and does not need to be collected
+# from the module's ports, declarations and parameters.
 */
-static int ig_tclc_get_objs_of_obj (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[])
+static int ig_tclc_get_local_names (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[])
 {
     struct ig_lib_db *db = (struct ig_lib_db *)clientdata;
 
     if (db == NULL) return tcl_error_msg (interp,  "Database is NULL");
 
-    /* command version */
-    const char                          *cmdname = Tcl_GetString (objv[0]);
-    enum ig_tclc_get_objs_of_obj_version version = ig_tclc_get_objs_of_obj_version_from_cmd (cmdname);
-
-    if (version == IG_TOOOV_INVALID) return tcl_error_msg (interp, "Internal Error - Invalid command version generated (%s:%d)", __FILE__, __LINE__);
-
-    /* arg parsing */
-    int int_true  = true;
-    int int_false = false;
-
-    int   all         = int_false;
-    char *parent_name = NULL;
-    char *child_name  = NULL;
+    Tcl_Obj *of_obj = NULL;
 
     Tcl_ArgvInfo arg_table [] = {
-        {TCL_ARGV_CONSTANT, "-all",    GINT_TO_POINTER (int_true), (void *)&all,         "return all objects", NULL},
-        {TCL_ARGV_STRING,   "-name",   NULL,                       (void *)&child_name,  "object name",        NULL},
-        {TCL_ARGV_STRING,   "-of",     NULL,                       (void *)&parent_name, "parent object",      NULL},
+        {TCL_ARGV_FUNC, "-of", (void *)(Tcl_ArgvFuncProc *)ig_tclc_tcl_obj_parse, (void *)&of_obj, "module id", NULL},
 
         TCL_ARGV_AUTO_HELP,
         TCL_ARGV_TABLE_END
@@ -715,55 +923,577 @@ static int ig_tclc_get_objs_of_obj (ClientData clientdata, Tcl_Interp *interp, i
 
     if (result != TCL_OK) return result;
 
-    /* sanity checks */
-    if (parent_name == NULL) {
-        if ((version == IG_TOOOV_DECLS) || (version == IG_TOOOV_PORTS) || (version == IG_TOOOV_PARAMS) || (version == IG_TOOOV_CODE)) {
-            return tcl_error_msg (interp, "Flag -of <module> needs to be specified");
-        } else if ((version == IG_TOOOV_PINS) || (version == IG_TOOOV_ADJ)) {
-            return tcl_error_msg (interp, "Flag -of <instance> needs to be specified");
-        } else if (version == IG_TOOOV_RF_ENTRIES) {
-            return tcl_error_msg (interp, "Flag -of <regfile> needs to be specified");
-        } else if (version == IG_TOOOV_RF_REGS) {
-            return tcl_error_msg (interp, "Flag -of <regfile-entry> needs to be specified");
-        }
+    if (of_obj == NULL) return tcl_error_msg (interp, "No module specified");
+
+    struct ig_object *obj = ig_tclc_objref_get (db, of_obj);
+
+    if ((obj == NULL) || (obj->type != IG_OBJ_MODULE)) {
+        return tcl_error_msg (interp, "Unable to find module \"%s\" in database", Tcl_GetString (of_obj));
     }
 
-    if ((version == IG_TOOOV_CODE) && (child_name != NULL)) {
-        return tcl_error_msg (interp, "Invalid to specify name for code sections");
+    Tcl_Obj       *retval = Tcl_NewDictObj ();
+    GHashTableIter iter;
+    gpointer       key;
+    gpointer       value;
+
+    g_hash_table_iter_init (&iter, IG_MODULE (obj)->local_names);
+    while (g_hash_table_iter_next (&iter, &key, &value)) {
+        Tcl_DictObjPut (interp, retval, Tcl_NewStringObj ((const char *)key, -1), Tcl_NewStringObj (PTR_TO_IG_OBJECT (value)->name, -1));
     }
 
-    if (((version == IG_TOOOV_NETS) || (version == IG_TOOOV_GENERICS)) && (child_name != NULL) && (parent_name != NULL)) {
-        return tcl_error_msg (interp, "Invalid to specify -name and -of");
+    Tcl_SetObjResult (interp, retval);
+
+    return TCL_OK;
+}
+
+/* command data of ig_tclc_expand_instances */
+struct ig_tclc_expand_data {
+    struct ig_lib_db *db;
+    GHashTable       *cache; /* key: (char *) separator length, separator and expression -> value: (Tcl_Obj *) list of expansions */
+};
+
+/* maximum number of cached instance expressions before the cache is cleared */
+#define IG_TCLC_EXPAND_CACHE_MAX 4096
+
+/* GDestroyNotify for Tcl objects */
+static void ig_tclc_obj_decref (gpointer obj)
+{
+    Tcl_DecrRefCount ((Tcl_Obj *)obj);
+}
+
+static struct ig_tclc_expand_data *ig_tclc_expand_data_new (struct ig_lib_db *db)
+{
+    struct ig_tclc_expand_data *data = g_new0 (struct ig_tclc_expand_data, 1);
+
+    data->db    = db;
+    data->cache = g_hash_table_new_full (g_str_hash, g_str_equal, g_free, ig_tclc_obj_decref);
+
+    return data;
+}
+
+static void ig_tclc_expand_data_free (ClientData clientdata)
+{
+    struct ig_tclc_expand_data *data = (struct ig_tclc_expand_data *)clientdata;
+
+    g_hash_table_destroy (data->cache);
+    g_free (data);
+}
+
+/* characters removed by tcl's [string trim] without explicit characters */
+static bool ig_tclc_is_trim_char (Tcl_UniChar c)
+{
+    return (((c >= 0x09) && (c <= 0x0d)) || (c == ' ') || (c == 0x00) || (c == 0x85) || (c == 0xa0)
+            || (c == 0x1680) || (c == 0x180e) || ((c >= 0x2000) && (c <= 0x200b)) || (c == 0x2028) || (c == 0x2029)
+            || (c == 0x202f) || (c == 0x205f) || (c == 0x2060) || (c == 0x3000) || (c == 0xfeff));
+}
+
+/* expand ranges of form <prefix><start>..<stop><suffix> in instance suffix and append results to list */
+static int ig_tclc_expand_range (Tcl_Interp *interp, const char *sfx, int len, Tcl_Obj *list)
+{
+    Tcl_UniChar c   = 0;
+    int         dot = 0;
+
+    /* prefix and start: word characters up to ".." */
+    while ((dot < len) && (sfx[dot] != '.')) {
+        int clen = Tcl_UtfToUniChar (sfx + dot, &c);
+        if (!Tcl_UniCharIsAlnum (c) && (c != '_')) break;
+        dot += clen;
     }
 
-    if (all && (child_name != NULL)) {
-        return tcl_error_msg (interp, "Invalid to specify name and -all");
+    int start = dot;
+    while (start > 0) {
+        const char *prev = Tcl_UtfPrev (sfx + start, sfx);
+        Tcl_UtfToUniChar (prev, &c);
+        if (!Tcl_UniCharIsDigit (c)) break;
+        start = prev - sfx;
     }
 
-    if (child_name == NULL) {
-        all = true;
+    bool match = ((dot + 1 < len) && (sfx[dot] == '.') && (sfx[dot+1] == '.') && (start < dot));
+
+    /* stop and suffix */
+    int stop_end = dot + 2;
+    if (match) {
+        while (stop_end < len) {
+            int clen = Tcl_UtfToUniChar (sfx + stop_end, &c);
+            if (!Tcl_UniCharIsDigit (c)) break;
+            stop_end += clen;
+        }
+        match = (stop_end > dot + 2);
+    }
+    for (int i = stop_end; match && (i < len); ) {
+        i += Tcl_UtfToUniChar (sfx + i, &c);
+        match = (Tcl_UniCharIsAlnum (c) || (c == '_') || (c == '.'));
     }
 
-    /* child list */
-    GList *child_list      = NULL;
-    bool   child_list_free = false;
+    if (!match) {
+        Tcl_ListObjAppendElement (NULL, list, Tcl_NewStringObj (sfx, len));
+        return TCL_OK;
+    }
 
-    if (((version == IG_TOOOV_INSTANCES) || (version == IG_TOOOV_INSTANTIATION)) && (parent_name == NULL)) {
-        if (all) {
-            child_list = g_hash_table_get_values (db->instances_by_id);
+    Tcl_Obj     *bounds[2] = {Tcl_NewStringObj (sfx + start, dot - start), Tcl_NewStringObj (sfx + dot + 2, stop_end - dot - 2)};
+    Tcl_WideInt  values[2] = {0, 0};
+    int          result    = TCL_OK;
+
+    Tcl_IncrRefCount (bounds[0]);
+    Tcl_IncrRefCount (bounds[1]);
+
+    if ((Tcl_GetWideIntFromObj (interp, bounds[0], &values[0]) != TCL_OK) || (Tcl_GetWideIntFromObj (interp, bounds[1], &values[1]) != TCL_OK)) {
+        result = TCL_ERROR;
+        goto l_ig_tclc_expand_range_exit;
+    }
+
+    int lo = (values[0] > values[1] ? 1 : 0);
+    int hi = 1 - lo;
+
+    /* first value keeps its original representation (e.g. leading zeros) */
+    for (Tcl_WideInt i = values[lo]; i <= values[hi]; i++) {
+        Tcl_Obj *item = Tcl_NewStringObj (sfx, start);
+        if (i == values[lo]) {
+            Tcl_AppendObjToObj (item, bounds[lo]);
         } else {
-            if (g_hash_table_contains (db->instances_by_name, child_name)) {
-                child_list = g_list_prepend (child_list, g_hash_table_lookup (db->instances_by_name, child_name));
-            }
+            Tcl_AppendPrintfToObj (item, "%" TCL_LL_MODIFIER "d", i);
         }
-        child_list_free = true;
-    } else if ((version == IG_TOOOV_MODULES) && (parent_name == NULL)) {
-        if (all) {
-            child_list = g_hash_table_get_values (db->modules_by_id);
-        } else {
-            if (g_hash_table_contains (db->modules_by_name, child_name)) {
-                child_list = g_list_prepend (child_list, g_hash_table_lookup (db->modules_by_name, child_name));
-            }
+        Tcl_AppendToObj (item, sfx + stop_end, len - stop_end);
+
+        int         item_len = 0;
+        const char *item_str = Tcl_GetStringFromObj (item, &item_len);
+
+        Tcl_IncrRefCount (item);
+        result = ig_tclc_expand_range (interp, item_str, item_len, list);
+        Tcl_DecrRefCount (item);
+
+        if (result != TCL_OK) break;
+        if (i == values[hi]) break;
+    }
+
+l_ig_tclc_expand_range_exit:
+    Tcl_DecrRefCount (bounds[0]);
+    Tcl_DecrRefCount (bounds[1]);
+
+    return result;
+}
+
+/* check for valid remainder of instance expression: empty or ":" followed by non-space characters */
+static bool ig_tclc_expand_rem_valid (const char *expr, int pos, int len)
+{
+    if (pos == len) return true;
+    if ((expr[pos] != ':') || (pos + 1 == len)) return false;
+
+    for (int i = pos + 1; i < len; ) {
+        Tcl_UniChar c = 0;
+        i += Tcl_UtfToUniChar (expr + i, &c);
+        if (Tcl_UniCharIsSpace (c)) return false;
+    }
+
+    return true;
+}
+
+/* expand single instance expression into list of {instance-name module-name remainder inverted} - returns NULL on error with message in interp */
+static Tcl_Obj *ig_tclc_expand_expression (Tcl_Interp *interp, const char *expr, int len, const char *separator)
+{
+    int pos = 0;
+
+    /* optional inversion */
+    const char *inv     = "";
+    int         inv_len = 0;
+    if ((len > 0) && (expr[0] == '~')) {
+        if ((len > 1) && (strchr ("<>:", expr[1]) == NULL)) {
+            inv     = "~";
+            inv_len = 1;
+            pos     = 1;
+        }
+    }
+
+    /* module name */
+    int mod_start = pos;
+    while ((pos < len) && (strchr ("<>:", expr[pos]) == NULL)) pos++;
+    int mod_len = pos - mod_start;
+    if (mod_len == 0) goto l_ig_tclc_expand_expression_parse_error;
+
+    /* instance suffixes: up to last ">" followed by valid remainder */
+    int insts_start = -1;
+    int insts_end   = -1;
+    if ((pos < len) && (expr[pos] == '<')) {
+        insts_start = pos + 1;
+        for (int i = len - 1; i >= insts_start; i--) {
+            if ((expr[i] == '>') && ig_tclc_expand_rem_valid (expr, i + 1, len)) {
+                insts_end = i;
+                break;
+            }
+        }
+        if (insts_end < 0) goto l_ig_tclc_expand_expression_parse_error;
+        pos = insts_end + 1;
+    }
+
+    /* remainder */
+    int rem_start = pos;
+    if (!ig_tclc_expand_rem_valid (expr, pos, len)) goto l_ig_tclc_expand_expression_parse_error;
+
+    Tcl_Obj *module = Tcl_NewStringObj (expr + mod_start, mod_len);
+    Tcl_Obj *rem    = Tcl_NewStringObj (expr + rem_start, len - rem_start);
+    Tcl_Obj *invobj = Tcl_NewStringObj (inv, inv_len);
+    Tcl_Obj *result = Tcl_NewListObj (0, NULL);
+
+    Tcl_IncrRefCount (module);
+    Tcl_IncrRefCount (rem);
+    Tcl_IncrRefCount (invobj);
+
+    if (insts_start < 0) {
+        Tcl_Obj *entry[4] = {module, module, rem, invobj};
+        Tcl_ListObjAppendElement (NULL, result, Tcl_NewListObj (4, entry));
+    } else {
+        Tcl_Obj *sfx_list = Tcl_NewListObj (0, NULL);
+        Tcl_IncrRefCount (sfx_list);
+
+        /* empty "<>" has no instance suffixes (like tcl split of an empty string) */
+        for (int i = insts_start; (i <= insts_end) && (insts_end > insts_start); ) {
+            int sep = i;
+            while ((sep < insts_end) && (expr[sep] != ',')) sep++;
+
+            /* trim */
+            int         s_start = i;
+            int         s_end   = sep;
+            Tcl_UniChar c       = 0;
+            while (s_start < s_end) {
+                int clen = Tcl_UtfToUniChar (expr + s_start, &c);
+                if (!ig_tclc_is_trim_char (c)) break;
+                s_start += clen;
+            }
+            while (s_end > s_start) {
+                const char *prev = Tcl_UtfPrev (expr + s_end, expr + s_start);
+                Tcl_UtfToUniChar (prev, &c);
+                if (!ig_tclc_is_trim_char (c)) break;
+                s_end = prev - expr;
+            }
+
+            if (ig_tclc_expand_range (interp, expr + s_start, s_end - s_start, sfx_list) != TCL_OK) {
+                Tcl_DecrRefCount (sfx_list);
+                Tcl_IncrRefCount (result);
+                Tcl_DecrRefCount (result);
+                result = NULL;
+                break;
+            }
+
+            i = sep + 1;
+        }
+
+        if (result != NULL) {
+            int       n_sfx = 0;
+            Tcl_Obj **sfxs  = NULL;
+            Tcl_ListObjGetElements (NULL, sfx_list, &n_sfx, &sfxs);
+
+            for (int i = 0; i < n_sfx; i++) {
+                Tcl_Obj *name = Tcl_DuplicateObj (module);
+                Tcl_AppendToObj (name, separator, -1);
+                Tcl_AppendObjToObj (name, sfxs[i]);
+
+                Tcl_Obj *entry[4] = {name, module, rem, invobj};
+                Tcl_ListObjAppendElement (NULL, result, Tcl_NewListObj (4, entry));
+            }
+            Tcl_DecrRefCount (sfx_list);
+        }
+    }
+
+    Tcl_DecrRefCount (module);
+    Tcl_DecrRefCount (rem);
+    Tcl_DecrRefCount (invobj);
+
+    return result;
+
+l_ig_tclc_expand_expression_parse_error:
+    tcl_error_msg (interp, "Could not parse instance expression \"%.*s\"", len, expr);
+    return NULL;
+}
+
+/* TCLDOC
+##
+# @brief Expand instance expressions (internal part of @ref ig::construct::expand_instances).
+#
+# @param args <b> -expressions &lt;list&gt; ?-separator &lt;sep&gt;? ?-ids? ?-merge?</b><br>
+#    <table style="border:0px; border-spacing:40px 0px;">
+#      <tr><td><b> list </b></td><td> list of instance expressions <br></td></tr>
+#      <tr><td><b> sep </b></td><td> separator between module name and instance suffix (default: "_") <br></td></tr>
+#      <tr><td><b> ids </b></td><td> resolve instance and module object ids <br></td></tr>
+#      <tr><td><b> merge </b></td><td> (only with -ids) return merged expressions of form [~]\<id\>\<remainder\> <br></td></tr>
+#    </table>
+#
+# @return List of expanded instance expressions {instance-name module-name remainder inverted}
+# or with ids {instance-id module-id remainder inverted}.
+#
+# Expansions of expressions are cached, so repeated identical expressions are only parsed once.
+# If no instance with an expanded instance-name exists, a module of this name is looked up.
+*/
+static int ig_tclc_expand_instances (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[])
+{
+    struct ig_tclc_expand_data *data = (struct ig_tclc_expand_data *)clientdata;
+    struct ig_lib_db           *db   = data->db;
+
+    if (db == NULL) return tcl_error_msg (interp,  "Database is NULL");
+
+    Tcl_Obj *expr_list = NULL;
+    char    *separator = "_";
+    int      ids       = 0;
+    int      merge     = 0;
+
+    Tcl_ArgvInfo arg_table [] = {
+        {TCL_ARGV_FUNC,     "-expressions", (void *)(Tcl_ArgvFuncProc *)ig_tclc_tcl_obj_parse, (void *)&expr_list, "list of instance expressions", NULL},
+        {TCL_ARGV_STRING,   "-separator",   NULL,                                              (void *)&separator, "separator between module name and instance suffix", NULL},
+        {TCL_ARGV_CONSTANT, "-ids",         GINT_TO_POINTER (1),                              (void *)&ids,       "resolve object ids", NULL},
+        {TCL_ARGV_CONSTANT, "-merge",       GINT_TO_POINTER (1),                              (void *)&merge,     "merge object ids and remainder", NULL},
+
+        TCL_ARGV_AUTO_HELP,
+        TCL_ARGV_TABLE_END
+    };
+
+    int result = Tcl_ParseArgsObjv (interp, arg_table, &objc, objv, NULL);
+    if (result != TCL_OK) return result;
+
+    if (expr_list == NULL) return tcl_error_msg (interp, "No instance expressions specified");
+
+    int       n_exprs = 0;
+    Tcl_Obj **exprs   = NULL;
+
+    if (Tcl_ListObjGetElements (interp, expr_list, &n_exprs, &exprs) != TCL_OK) return TCL_ERROR;
+
+    Tcl_Obj *retval = Tcl_NewListObj (0, NULL);
+    GString *key    = g_string_new (NULL);
+
+    Tcl_IncrRefCount (retval);
+
+    for (int i = 0; i < n_exprs; i++) {
+        int         len  = 0;
+        const char *expr = Tcl_GetStringFromObj (exprs[i], &len);
+
+        g_string_printf (key, "%zu:%s%s", strlen (separator), separator, expr);
+
+        Tcl_Obj *expansion = (Tcl_Obj *)g_hash_table_lookup (data->cache, key->str);
+        if (expansion == NULL) {
+            expansion = ig_tclc_expand_expression (interp, expr, len, separator);
+            if (expansion == NULL) {
+                result = TCL_ERROR;
+                goto l_ig_tclc_expand_instances_exit;
+            }
+
+            if (g_hash_table_size (data->cache) >= IG_TCLC_EXPAND_CACHE_MAX) {
+                g_hash_table_remove_all (data->cache);
+            }
+            Tcl_IncrRefCount (expansion);
+            g_hash_table_insert (data->cache, g_strdup (key->str), expansion);
+        }
+
+        if (!ids) {
+            Tcl_ListObjAppendList (NULL, retval, expansion);
+            continue;
+        }
+
+        int       n_entries = 0;
+        Tcl_Obj **entries   = NULL;
+        Tcl_ListObjGetElements (NULL, expansion, &n_entries, &entries);
+
+        for (int j = 0; j < n_entries; j++) {
+            Tcl_Obj **entry = NULL;
+            int       n     = 0;
+            Tcl_ListObjGetElements (NULL, entries[j], &n, &entry);
+
+            const char       *inst_name = Tcl_GetString (entry[0]);
+            struct ig_object *inst      = PTR_TO_IG_OBJECT (g_hash_table_lookup (db->instances_by_name, inst_name));
+            if (inst == NULL) {
+                inst = PTR_TO_IG_OBJECT (g_hash_table_lookup (db->modules_by_name, inst_name));
+            }
+            if (inst == NULL) {
+                result = tcl_error_msg (interp, "Nothing found for \"%s\"", inst_name);
+                goto l_ig_tclc_expand_instances_exit;
+            }
+
+            if (merge) {
+                Tcl_Obj *merged = Tcl_DuplicateObj (entry[3]);
+                Tcl_AppendToObj (merged, inst->id, -1);
+                Tcl_AppendObjToObj (merged, entry[2]);
+                Tcl_ListObjAppendElement (NULL, retval, merged);
+            } else {
+                const char       *mod_name = Tcl_GetString (entry[1]);
+                struct ig_object *mod      = PTR_TO_IG_OBJECT (g_hash_table_lookup (db->modules_by_name, mod_name));
+                if (mod == NULL) {
+                    result = tcl_error_msg (interp, "Nothing found for \"%s\"", mod_name);
+                    goto l_ig_tclc_expand_instances_exit;
+                }
+
+                Tcl_Obj *id_entry[4] = {ig_tclc_objref_new (db, inst), ig_tclc_objref_new (db, mod), entry[2], entry[3]};
+                Tcl_ListObjAppendElement (NULL, retval, Tcl_NewListObj (4, id_entry));
+            }
+        }
+    }
+
+    Tcl_SetObjResult (interp, retval);
+
+l_ig_tclc_expand_instances_exit:
+    Tcl_DecrRefCount (retval);
+    g_string_free (key, true);
+
+    return result;
+}
+
+enum ig_tclc_get_objs_of_obj_version {
+    IG_TOOOV_INVALID,
+    IG_TOOOV_PINS,
+    IG_TOOOV_PORTS,
+    IG_TOOOV_DECLS,
+    IG_TOOOV_ADJ,
+    IG_TOOOV_PARAMS,
+    IG_TOOOV_CODE,
+    IG_TOOOV_MODULES,
+    IG_TOOOV_INSTANCES,
+    IG_TOOOV_INSTANTIATION,
+    IG_TOOOV_REGFILES,
+    IG_TOOOV_RF_ENTRIES,
+    IG_TOOOV_RF_REGS,
+    IG_TOOOV_NETS,
+    IG_TOOOV_GENERICS,
+};
+
+static enum ig_tclc_get_objs_of_obj_version ig_tclc_get_objs_of_obj_version_from_cmd (const char *cmdname)
+{
+    while (true) {
+        const char *cmdchomp = strstr (cmdname, "::");
+        if (cmdchomp == NULL) break;
+        cmdname = cmdchomp + 2;
+    }
+    enum ig_tclc_get_objs_of_obj_version version = IG_TOOOV_INVALID;
+
+    if (strcmp (cmdname, "get_ports") == 0) {
+        version = IG_TOOOV_PORTS;
+    } else if (strcmp (cmdname, "get_declarations") == 0) {
+        version = IG_TOOOV_DECLS;
+    } else if (strcmp (cmdname, "get_parameters") == 0) {
+        version = IG_TOOOV_PARAMS;
+    } else if (strcmp (cmdname, "get_codesections") == 0) {
+        version = IG_TOOOV_CODE;
+    } else if (strcmp (cmdname, "get_pins") == 0) {
+        version = IG_TOOOV_PINS;
+    } else if (strcmp (cmdname, "get_adjustments") == 0) {
+        version = IG_TOOOV_ADJ;
+    } else if (strcmp (cmdname, "get_modules") == 0) {
+        version = IG_TOOOV_MODULES;
+    } else if (strcmp (cmdname, "get_instances") == 0) {
+        version = IG_TOOOV_INSTANCES;
+    } else if (strcmp (cmdname, "get_instantiation") == 0) {
+        version = IG_TOOOV_INSTANTIATION;
+    } else if (strcmp (cmdname, "get_regfiles") == 0) {
+        version = IG_TOOOV_REGFILES;
+    } else if (strcmp (cmdname, "get_regfile_entries") == 0) {
+        version = IG_TOOOV_RF_ENTRIES;
+    } else if (strcmp (cmdname, "get_regfile_regs") == 0) {
+        version = IG_TOOOV_RF_REGS;
+    } else if (strcmp (cmdname, "get_nets") == 0) {
+        version = IG_TOOOV_NETS;
+    } else if (strcmp (cmdname, "get_generics") == 0) {
+        version = IG_TOOOV_GENERICS;
+    }
+
+    return version;
+}
+
+/* TCLDOC
+##
+# @brief Return child object(s) of given parent.
+#
+# @param args Parsed command arguments:<br>
+# (-name \<child-name\><br>
+# |-all)<br>
+# -of \<parent-object-id\>
+#
+# @return Object-ID(s) of child object(s) or an error
+*/
+static int ig_tclc_get_objs_of_obj (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[])
+{
+    struct ig_lib_db *db = (struct ig_lib_db *)clientdata;
+
+    if (db == NULL) return tcl_error_msg (interp,  "Database is NULL");
+
+    /* command version */
+    const char                          *cmdname = Tcl_GetString (objv[0]);
+    enum ig_tclc_get_objs_of_obj_version version = ig_tclc_get_objs_of_obj_version_from_cmd (cmdname);
+
+    if (version == IG_TOOOV_INVALID) return tcl_error_msg (interp, "Internal Error - Invalid command version generated (%s:%d)", __FILE__, __LINE__);
+
+    /* arg parsing */
+    int int_true  = true;
+    int int_false = false;
+
+    int      all        = int_false;
+    Tcl_Obj *parent_ref = NULL;
+    char    *child_name = NULL;
+
+    Tcl_ArgvInfo arg_table [] = {
+        {TCL_ARGV_CONSTANT, "-all",    GINT_TO_POINTER (int_true),                        (void *)&all,        "return all objects", NULL},
+        {TCL_ARGV_STRING,   "-name",   NULL,                                              (void *)&child_name, "object name",        NULL},
+        {TCL_ARGV_FUNC,     "-of",     (void *)(Tcl_ArgvFuncProc *)ig_tclc_tcl_obj_parse, (void *)&parent_ref, "parent object",      NULL},
+
+        TCL_ARGV_AUTO_HELP,
+        TCL_ARGV_TABLE_END
+    };
+
+    int result = Tcl_ParseArgsObjv (interp, arg_table, &objc, objv, NULL);
+
+    if (result != TCL_OK) return result;
+
+    const char       *parent_name = NULL;
+    struct ig_object *parent_obj  = NULL;
+    if (parent_ref != NULL) {
+        parent_obj  = ig_tclc_objref_get (db, parent_ref);
+        parent_name = Tcl_GetString (parent_ref);
+    }
+
+    /* sanity checks */
+    if (parent_name == NULL) {
+        if ((version == IG_TOOOV_DECLS) || (version == IG_TOOOV_PORTS) || (version == IG_TOOOV_PARAMS) || (version == IG_TOOOV_CODE)) {
+            return tcl_error_msg (interp, "Flag -of <module> needs to be specified");
+        } else if ((version == IG_TOOOV_PINS) || (version == IG_TOOOV_ADJ)) {
+            return tcl_error_msg (interp, "Flag -of <instance> needs to be specified");
+        } else if (version == IG_TOOOV_RF_ENTRIES) {
+            return tcl_error_msg (interp, "Flag -of <regfile> needs to be specified");
+        } else if (version == IG_TOOOV_RF_REGS) {
+            return tcl_error_msg (interp, "Flag -of <regfile-entry> needs to be specified");
+        }
+    }
+
+    if ((version == IG_TOOOV_CODE) && (child_name != NULL)) {
+        return tcl_error_msg (interp, "Invalid to specify name for code sections");
+    }
+
+    if (((version == IG_TOOOV_NETS) || (version == IG_TOOOV_GENERICS)) && (child_name != NULL) && (parent_name != NULL)) {
+        return tcl_error_msg (interp, "Invalid to specify -name and -of");
+    }
+
+    if (all && (child_name != NULL)) {
+        return tcl_error_msg (interp, "Invalid to specify name and -all");
+    }
+
+    if (child_name == NULL) {
+        all = true;
+    }
+
+    /* child list */
+    GList  *child_list      = NULL;
+    GQueue *child_queue     = NULL;
+    bool    child_list_free = false;
+
+    if (((version == IG_TOOOV_INSTANCES) || (version == IG_TOOOV_INSTANTIATION)) && (parent_name == NULL)) {
+        if (all) {
+            child_list = g_hash_table_get_values (db->instances_by_id);
+        } else {
+            if (g_hash_table_contains (db->instances_by_name, child_name)) {
+                child_list = g_list_prepend (child_list, g_hash_table_lookup (db->instances_by_name, child_name));
+            }
+        }
+        child_list_free = true;
+    } else if ((version == IG_TOOOV_MODULES) && (parent_name == NULL)) {
+        if (all) {
+            child_list = g_hash_table_get_values (db->modules_by_id);
+        } else {
+            if (g_hash_table_contains (db->modules_by_name, child_name)) {
+                child_list = g_list_prepend (child_list, g_hash_table_lookup (db->modules_by_name, child_name));
+            }
         }
         child_list_free = true;
     } else if ((version == IG_TOOOV_REGFILES) && (parent_name == NULL)) {
@@ -795,7 +1525,10 @@ static int ig_tclc_get_objs_of_obj (ClientData clientdata, Tcl_Interp *interp, i
         child_list_free = true;
     } else if ((version == IG_TOOOV_DECLS) || (version == IG_TOOOV_PORTS) || (version == IG_TOOOV_PARAMS)
                || (version == IG_TOOOV_CODE) || (version == IG_TOOOV_INSTANCES) || (version == IG_TOOOV_INSTANTIATION) || (version == IG_TOOOV_REGFILES)) {
-        struct ig_module *mod = IG_MODULE (PTR_TO_IG_OBJECT (g_hash_table_lookup (db->modules_by_id, parent_name)));
+        struct ig_module *mod = NULL;
+        if ((parent_obj != NULL) && (parent_obj->type == IG_OBJ_MODULE)) {
+            mod = IG_MODULE (parent_obj);
+        }
         if (mod == NULL) {
             return tcl_error_msg (interp, "Unable to find \"%s\" in database", parent_name);
         }
@@ -808,52 +1541,55 @@ static int ig_tclc_get_objs_of_obj (ClientData clientdata, Tcl_Interp *interp, i
         }
 
         if (version == IG_TOOOV_DECLS) {
-            child_list = mod->decls->head;
+            child_queue = mod->decls;
         } else if (version == IG_TOOOV_PORTS) {
-            child_list = mod->ports->head;
+            child_queue = mod->ports;
         } else if (version == IG_TOOOV_PARAMS) {
-            child_list = mod->params->head;
+            child_queue = mod->params;
         } else if (version == IG_TOOOV_CODE) {
-            child_list = mod->code->head;
+            child_queue = mod->code;
         } else if (version == IG_TOOOV_INSTANCES) {
-            child_list = mod->child_instances->head;
+            child_queue = mod->child_instances;
         } else if (version == IG_TOOOV_INSTANTIATION) {
-            child_list = mod->mod_instances->head;
+            child_queue = mod->mod_instances;
         } else if (version == IG_TOOOV_REGFILES) {
-            child_list = mod->regfiles->head;
+            child_queue = mod->regfiles;
         }
     } else if ((version == IG_TOOOV_PINS) || (version == IG_TOOOV_ADJ) || (version == IG_TOOOV_MODULES)) {
-        struct ig_instance *inst = IG_INSTANCE (PTR_TO_IG_OBJECT (g_hash_table_lookup (db->instances_by_id, parent_name)));
+        struct ig_instance *inst = NULL;
+        if ((parent_obj != NULL) && (parent_obj->type == IG_OBJ_INSTANCE)) {
+            inst = IG_INSTANCE (parent_obj);
+        }
         if (inst == NULL) return tcl_error_msg (interp, "Unable to find instance-id \"%s\"", parent_name);
 
         if (version == IG_TOOOV_PINS) {
-            child_list = inst->pins->head;
+            child_queue = inst->pins;
         } else if (version == IG_TOOOV_ADJ) {
-            child_list = inst->adjustments->head;
+            child_queue = inst->adjustments;
         } else if (version == IG_TOOOV_MODULES) {
             child_list      = g_list_prepend (child_list, inst->module);
             child_list_free = true;
         }
     } else if (version == IG_TOOOV_RF_ENTRIES) {
-        struct ig_object *obj = PTR_TO_IG_OBJECT (g_hash_table_lookup (db->objects_by_id, parent_name));
+        struct ig_object *obj = parent_obj;
 
         if ((obj == NULL) || (obj->type != IG_OBJ_REGFILE)) {
             return tcl_error_msg (interp, "Unable to get regfile \"%s\" from database", parent_name);
         }
 
         struct ig_rf_regfile *regfile = IG_RF_REGFILE (obj);
-        child_list = regfile->entries->head;
+        child_queue = regfile->entries;
     } else if (version == IG_TOOOV_RF_REGS) {
-        struct ig_object *obj = PTR_TO_IG_OBJECT (g_hash_table_lookup (db->objects_by_id, parent_name));
+        struct ig_object *obj = parent_obj;
 
         if ((obj == NULL) || (obj->type != IG_OBJ_REGFILE_ENTRY)) {
             return tcl_error_msg (interp, "Unable to get regfile-entry \"%s\" from database", parent_name);
         }
 
         struct ig_rf_entry *entry = IG_RF_ENTRY (obj);
-        child_list = entry->regs->head;
+        child_queue = entry->regs;
     } else if (version == IG_TOOOV_NETS) {
-        struct ig_object *obj = PTR_TO_IG_OBJECT (g_hash_table_lookup (db->objects_by_id, parent_name));
+        struct ig_object *obj = parent_obj;
         if (obj == NULL) {
             return tcl_error_msg (interp, "Unable to get object \"%s\" from database for net lookup", parent_name);
         }
@@ -875,7 +1611,7 @@ static int ig_tclc_get_objs_of_obj (ClientData clientdata, Tcl_Interp *interp, i
 
         child_list_free = true;
     } else if (version == IG_TOOOV_GENERICS) {
-        struct ig_object *obj = PTR_TO_IG_OBJECT (g_hash_table_lookup (db->objects_by_id, parent_name));
+        struct ig_object *obj = parent_obj;
         if (obj == NULL) {
             return tcl_error_msg (interp, "Unable to get object \"%s\" from database for generic lookup", parent_name);
         }
@@ -896,6 +1632,19 @@ static int ig_tclc_get_objs_of_obj (ClientData clientdata, Tcl_Interp *interp, i
         child_list_free = true;
     }
 
+    if (child_queue != NULL) {
+        if (!all) {
+            /* single child of parent object: indexed lookup */
+            struct ig_object *child = ig_obj_child_by_name (parent_obj, child_queue, child_name);
+            if (child != NULL) {
+                Tcl_SetObjResult (interp, ig_tclc_objref_new (db, child));
+                return TCL_OK;
+            }
+        } else {
+            child_list = child_queue->head;
+        }
+    }
+
     /* generate result */
     Tcl_Obj *retval = NULL;
 
@@ -908,11 +1657,11 @@ static int ig_tclc_get_objs_of_obj (ClientData clientdata, Tcl_Interp *interp, i
         const char       *i_name = i_obj->name;
 
         if (all) {
-            Tcl_Obj *t_obj = Tcl_NewStringObj (i_obj->id, -1);
+            Tcl_Obj *t_obj = ig_tclc_objref_new (db, i_obj);
             Tcl_ListObjAppendElement (interp, retval, t_obj);
         } else {
             if (strcmp (i_name, child_name) == 0) {
-                Tcl_SetObjResult (interp, Tcl_NewStringObj (i_obj->id, -1));
+                Tcl_SetObjResult (interp, ig_tclc_objref_new (db, i_obj));
                 if (child_list_free) g_list_free (child_list);
                 return TCL_OK;
             }
@@ -1026,7 +1775,7 @@ static int ig_tclc_get_netgen_objects (ClientData clientdata, Tcl_Interp *interp
     for (GList *li = children; li != NULL; li = li->next) {
         struct ig_object *i_obj = PTR_TO_IG_OBJECT (li->data);
 
-        Tcl_Obj *t_obj = Tcl_NewStringObj (i_obj->id, -1);
+        Tcl_Obj *t_obj = ig_tclc_objref_new (db, i_obj);
         Tcl_ListObjAppendElement (interp, retval, t_obj);
     }
 
@@ -1085,57 +1834,108 @@ static void ig_tclc_connection_parse (const char *input, GString *id, GString *n
     ig_tclc_check_name_and_warn (net->str);
 }
 
-static void ig_tclc_check_name_and_warn (const char *name)
+/* resolved connection endpoint string (connect_batch endpoint cache) */
+struct ig_tclc_endpoint {
+    struct ig_object *obj;
+    char             *id;
+    char             *net;
+    bool              adapt;
+    bool              inv;
+};
+
+static void ig_tclc_endpoint_free (gpointer data)
 {
-    if (name == NULL) return;
+    struct ig_tclc_endpoint *ep = (struct ig_tclc_endpoint *)data;
 
-    const char unwanted[] = {'"', '\'', '!', ':', '$', ' ', '{', '}', '[', ']', '<', '>', '(', ')', 0};
+    if (ep == NULL) return;
 
-    for (const char *cp = &(unwanted[0]); *cp != 0; cp++) {
-        if (strchr (name, *cp) != NULL) {
-            log_warn ("TChkN", "Got identifier \"%s\" containing probably unwanted character \"%c\".", name, *cp);
-        }
-    }
+    g_free (ep->id);
+    g_free (ep->net);
+    g_slice_free (struct ig_tclc_endpoint, ep);
 }
 
-/* TCLDOC
-##
-# @brief Create a signal connecting modules/instances.
-#
-# @param args Parsed command arguments:<br>
-# -signal-name \<signal-name\><br>
-# [-signal-size \<signal-bitwidth\>]<br>
-# (-bidir {\<endpoint1\> \<endpoint2\> ...}<br>
-# |-from \<startpoint\><br>
-#  -to {\<endpoint1\> \<endpoint2\> ...})<br>
-#
-# @return Net object of the newly created signal or an error
-#
-# Start-/Endpoints must be of the form "<Object-ID>[-><local name>[!]]"
-# where \<Object-ID\> is a module or instance object and optionally
-# \<local name\> specifies the name of the signal at the given object (=pin/port).
-# The optional [!] adapts the local name suffix at the specified object,
-# otherwise the name is kept verbatim.
-#
-*/
-static int ig_tclc_connect (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[])
+/* get object of connection endpoint, either a plain object reference or a string as parsed by ig_tclc_connection_parse,
+ * string endpoints are resolved only once if cache is not NULL */
+static struct ig_object *ig_tclc_connection_endpoint (struct ig_lib_db *db, Tcl_Obj *input, GString *id, GString *net, bool *adapt, bool *inv, GHashTable *cache)
 {
-    struct ig_lib_db *db = (struct ig_lib_db *)clientdata;
+    struct ig_object *obj = ig_tclc_objref_get_cached (db, input);
 
-    if (db == NULL) return tcl_error_msg (interp,  "Database is NULL");
+    if ((obj != NULL) && (strchr (obj->id, ':') == NULL)) {
+        g_string_assign (id, obj->id);
+        g_string_assign (net, "");
+        *adapt = true;
+        *inv   = false;
+        return obj;
+    }
+
+    const char *input_str = Tcl_GetString (input);
+
+    if (cache != NULL) {
+        struct ig_tclc_endpoint *ep = (struct ig_tclc_endpoint *)g_hash_table_lookup (cache, input_str);
+
+        if (ep != NULL) {
+            g_string_assign (id, ep->id);
+            g_string_assign (net, ep->net);
+            *adapt = ep->adapt;
+            *inv   = ep->inv;
+            return ep->obj;
+        }
+    }
+
+    ig_tclc_connection_parse (input_str, id, net, adapt, inv);
+    obj = PTR_TO_IG_OBJECT (g_hash_table_lookup (db->objects_by_id, id->str));
+
+    if ((obj != NULL) && (strcmp (input_str, obj->id) == 0)) {
+        ig_tclc_objref_set (db, input, obj);
+    }
+
+    if (cache != NULL) {
+        struct ig_tclc_endpoint *ep = g_slice_new (struct ig_tclc_endpoint);
+
+        ep->obj   = obj;
+        ep->id    = g_strdup (id->str);
+        ep->net   = g_strdup (net->str);
+        ep->adapt = *adapt;
+        ep->inv   = *inv;
+        g_hash_table_insert (cache, g_strdup (input_str), ep);
+    }
 
-    char  *from    = NULL;
-    char  *name    = NULL;
-    char  *size    = NULL;
-    GList *to_list = NULL;
-    GList *bd_list = NULL;
+    return obj;
+}
+
+static void ig_tclc_check_name_and_warn (const char *name)
+{
+    if (name == NULL) return;
+
+    const char unwanted[] = {'"', '\'', '!', ':', '$', ' ', '{', '}', '[', ']', '<', '>', '(', ')', 0};
+
+    for (const char *cp = &(unwanted[0]); *cp != 0; cp++) {
+        if (strchr (name, *cp) != NULL) {
+            log_warn ("TChkN", "Got identifier \"%s\" containing probably unwanted character \"%c\".", name, *cp);
+        }
+    }
+}
+
+/* parse arguments of a single signal (connect/connect_batch) and generate connection info */
+static int ig_tclc_connection_spec_parse (struct ig_lib_db *db, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[], struct ig_lib_connection_spec *spec, const char **size_out, GHashTable *cache)
+{
+    Tcl_Obj *from    = NULL;
+    char    *name    = NULL;
+    char    *size    = NULL;
+    GList   *to_list = NULL;
+    GList   *bd_list = NULL;
+
+    spec->signame = NULL;
+    spec->source  = NULL;
+    spec->targets = NULL;
+    spec->net     = NULL;
 
     Tcl_ArgvInfo arg_table [] = {
-        {TCL_ARGV_STRING,   "-signal-name", NULL,                                                      (void *)&name,    "signal (prefix) name", NULL},
-        {TCL_ARGV_STRING,   "-signal-size", NULL,                                                      (void *)&size,    "signal (bus) size", NULL},
-        {TCL_ARGV_STRING,   "-from",        NULL,                                                      (void *)&from,    "start of signal (unidirectional)", NULL},
-        {TCL_ARGV_FUNC,     "-to",          (void *)(Tcl_ArgvFuncProc *)ig_tclc_tcl_string_list_parse, (void *)&to_list, "list of signal endpoints", NULL},
-        {TCL_ARGV_FUNC,     "-bidir",       (void *)(Tcl_ArgvFuncProc *)ig_tclc_tcl_string_list_parse, (void *)&bd_list, "list of endpoints connected bidirectional", NULL},
+        {TCL_ARGV_STRING,   "-signal-name", NULL,                                                   (void *)&name,    "signal (prefix) name", NULL},
+        {TCL_ARGV_STRING,   "-signal-size", NULL,                                                   (void *)&size,    "signal (bus) size", NULL},
+        {TCL_ARGV_FUNC,     "-from",        (void *)(Tcl_ArgvFuncProc *)ig_tclc_tcl_obj_parse,      (void *)&from,    "start of signal (unidirectional)", NULL},
+        {TCL_ARGV_FUNC,     "-to",          (void *)(Tcl_ArgvFuncProc *)ig_tclc_tcl_obj_list_parse, (void *)&to_list, "list of signal endpoints", NULL},
+        {TCL_ARGV_FUNC,     "-bidir",       (void *)(Tcl_ArgvFuncProc *)ig_tclc_tcl_obj_list_parse, (void *)&bd_list, "list of endpoints connected bidirectional", NULL},
 
         TCL_ARGV_AUTO_HELP,
         TCL_ARGV_TABLE_END
@@ -1143,7 +1943,7 @@ static int ig_tclc_connect (ClientData clientdata, Tcl_Interp *interp, int objc,
 
     int result = Tcl_ParseArgsObjv (interp, arg_table, &objc, objv, NULL);
 
-    if (result != TCL_OK) goto l_ig_tclc_connect_exit;
+    if (result != TCL_OK) goto l_ig_tclc_connection_spec_parse_exit;
 
     if (name == NULL) {
         result = tcl_error_msg (interp, "Signal name is required");
@@ -1158,7 +1958,7 @@ static int ig_tclc_connect (ClientData clientdata, Tcl_Interp *interp, int objc,
         size = "1";
     }
 
-    if (result != TCL_OK) goto l_ig_tclc_connect_exit;
+    if (result != TCL_OK) goto l_ig_tclc_connection_spec_parse_exit;
 
     log_debug ("TCCon", "generating connection info");
 
@@ -1169,12 +1969,11 @@ static int ig_tclc_connect (ClientData clientdata, Tcl_Interp *interp, int objc,
     bool                           t_adapt  = false;
 
     if (from != NULL) {
-        bool inv = false;
-        ig_tclc_connection_parse (from, tstr_id, tstr_net, &t_adapt, &inv);
-        struct ig_object *src_obj = PTR_TO_IG_OBJECT (g_hash_table_lookup (db->objects_by_id, tstr_id->str));
+        bool              inv     = false;
+        struct ig_object *src_obj = ig_tclc_connection_endpoint (db, from, tstr_id, tstr_net, &t_adapt, &inv, cache);
         if (src_obj == NULL) {
             log_error ("TCCon", "Signal \"%s\": could not find object for id \"%s\"", name, tstr_id->str);
-            goto l_ig_tclc_connect_nfexit;
+            goto l_ig_tclc_connection_spec_parse_nfexit;
         }
 
         if (tstr_net->len > 0) {
@@ -1195,12 +1994,11 @@ static int ig_tclc_connect (ClientData clientdata, Tcl_Interp *interp, int objc,
     }
 
     for (GList *li = trg_orig_list; li != NULL; li = li->next) {
-        bool inv = false;
-        ig_tclc_connection_parse ((const char *)li->data, tstr_id, tstr_net, &t_adapt, &inv);
-        struct ig_object *trg_obj = PTR_TO_IG_OBJECT (g_hash_table_lookup (db->objects_by_id, tstr_id->str));
+        bool              inv     = false;
+        struct ig_object *trg_obj = ig_tclc_connection_endpoint (db, (Tcl_Obj *)li->data, tstr_id, tstr_net, &t_adapt, &inv, cache);
         if (trg_obj == NULL) {
             log_error ("TCCon", "Signal \"%s\": could not find object for id \"%s\"", name, tstr_id->str);
-            goto l_ig_tclc_connect_nfexit;
+            goto l_ig_tclc_connection_spec_parse_nfexit;
         }
 
         struct ig_lib_connection_info *trg = NULL;
@@ -1215,51 +2013,212 @@ static int ig_tclc_connect (ClientData clientdata, Tcl_Interp *interp, int objc,
     }
     trg_list = g_list_reverse (trg_list);
 
+    spec->signame = name;
+    spec->source  = src;
+    spec->targets = trg_list;
+    *size_out     = size;
+
+l_ig_tclc_connection_spec_parse_exit_pre:
+    g_string_free (tstr_id, true);
+    g_string_free (tstr_net, true);
+
+l_ig_tclc_connection_spec_parse_exit:
+    g_list_free (to_list);
+    g_list_free (bd_list);
+
+    return result;
+
+l_ig_tclc_connection_spec_parse_nfexit:
+    if (src != NULL) {
+        ig_lib_connection_info_free (src);
+    }
+    for (GList *li = trg_list; li != NULL; li = li->next) {
+        struct ig_lib_connection_info *trg = (struct ig_lib_connection_info *)li->data;
+        ig_lib_connection_info_free (trg);
+    }
+    g_list_free (trg_list);
+    result = tcl_error_msg (interp, "Error: could not find object");
+    goto l_ig_tclc_connection_spec_parse_exit_pre;
+}
+
+/* set size attribute of net and all its objects */
+static void ig_tclc_connection_set_size (struct ig_net *net, const char *size)
+{
+    ig_obj_attr_set_by_key (IG_OBJECT (net), IG_AK_SIZE, size, false);
+    for (GList *li = net->objects->head; li != NULL; li = li->next) {
+        struct ig_object *i_obj = PTR_TO_IG_OBJECT (li->data);
+
+        ig_obj_attr_set_by_key (i_obj, IG_AK_SIZE, size, false);
+    }
+}
+
+/* TCLDOC
+##
+# @brief Create a signal connecting modules/instances.
+#
+# @param args Parsed command arguments:<br>
+# -signal-name \<signal-name\><br>
+# [-signal-size \<signal-bitwidth\>]<br>
+# (-bidir {\<endpoint1\> \<endpoint2\> ...}<br>
+# |-from \<startpoint\><br>
+#  -to {\<endpoint1\> \<endpoint2\> ...})<br>
+#
+# @return Net object of the newly created signal or an error
+#
+# Start-/Endpoints must be of the form "<Object-ID>[-><local name>[!]]"
+# where \<Object-ID\> is a module or instance object and optionally
+# \<local name\> specifies the name of the signal at the given object (=pin/port).
+# The optional [!] adapts the local name suffix at the specified object,
+# otherwise the name is kept verbatim.
+#
+*/
+static int ig_tclc_connect (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[])
+{
+    struct ig_lib_db *db = (struct ig_lib_db *)clientdata;
+
+    if (db == NULL) return tcl_error_msg (interp,  "Database is NULL");
+
+    struct ig_lib_connection_spec spec;
+    const char                   *size = NULL;
+
+    int result = ig_tclc_connection_spec_parse (db, interp, objc, objv, &spec, &size, NULL);
+
+    if (result != TCL_OK) return result;
+
     log_debug ("TCCon", "starting connection...");
     struct ig_net *gen_net = NULL;
 
-    if (!ig_lib_connection (db, name, src, trg_list, &gen_net)) {
+    if (!ig_lib_connection (db, spec.signame, spec.source, spec.targets, &gen_net)) {
         ig_net_free (gen_net);
-        result = tcl_error_msg (interp, "Signal \"%s\", error while trying to create connection", name);
-        goto l_ig_tclc_connect_exit_pre;
+        return tcl_error_msg (interp, "Signal \"%s\", error while trying to create connection", spec.signame);
     }
     log_debug ("TCCon", "... finished connection");
 
-    ig_obj_attr_set (IG_OBJECT (gen_net), "size", size, false);
-    for (GList *li = gen_net->objects->head; li != NULL; li = li->next) {
-        struct ig_object *i_obj = PTR_TO_IG_OBJECT (li->data);
+    ig_tclc_connection_set_size (gen_net, size);
 
-        ig_obj_attr_set (i_obj, "size", size, false);
-    }
+    Tcl_SetObjResult (interp, ig_tclc_objref_new (db, IG_OBJECT (gen_net)));
+
+    return TCL_OK;
+}
 
-    Tcl_Obj *retval = Tcl_NewStringObj (IG_OBJECT (gen_net)->id, -1);
+/* TCLDOC
+##
+# @brief Create multiple signals connecting modules/instances in one call.
+#
+# @param args Parsed command arguments:<br>
+# -signals {\<signal-spec1\> \<signal-spec2\> ...}<br>
+#
+# @return List with one status per signal in order of the specifications:
+# "ok \<net-object\>" for a created signal or "error \<message\>" for a signal that could not be created.
+#
+# Each \<signal-spec\> is a list of arguments as for @ref connect.
+# Endpoints given by the same string are resolved only once per call,
+# errors in individual specifications do not affect the other signals.
+#
+*/
+static int ig_tclc_connect_batch (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[])
+{
+    struct ig_lib_db *db = (struct ig_lib_db *)clientdata;
 
-    log_debug ("TCCon", "freeing results...");
+    if (db == NULL) return tcl_error_msg (interp,  "Database is NULL");
 
-    Tcl_SetObjResult (interp, retval);
+    Tcl_Obj *signals = NULL;
 
-l_ig_tclc_connect_exit_pre:
-    g_string_free (tstr_id, true);
-    g_string_free (tstr_net, true);
+    Tcl_ArgvInfo arg_table [] = {
+        {TCL_ARGV_FUNC, "-signals", (void *)(Tcl_ArgvFuncProc *)ig_tclc_tcl_obj_parse, (void *)&signals, "list of signal specifications", NULL},
 
-l_ig_tclc_connect_exit:
-    g_list_free (to_list);
-    g_list_free (bd_list);
+        TCL_ARGV_AUTO_HELP,
+        TCL_ARGV_TABLE_END
+    };
 
-    log_debug ("TCCon", "... freed results");
+    int result = Tcl_ParseArgsObjv (interp, arg_table, &objc, objv, NULL);
 
-    return result;
+    if (result != TCL_OK) return result;
 
-l_ig_tclc_connect_nfexit:
-    if (src != NULL) {
-        ig_lib_connection_info_free (src);
+    if (signals == NULL) return tcl_error_msg (interp, "Flag -signals needs to be specified");
+
+    int       sig_count = 0;
+    Tcl_Obj **sig_objs  = NULL;
+
+    if (Tcl_ListObjGetElements (interp, signals, &sig_count, &sig_objs) != TCL_OK) return TCL_ERROR;
+
+    struct ig_lib_connection_spec *specs     = g_new0 (struct ig_lib_connection_spec, sig_count);
+    const char                   **sizes     = g_new0 (const char *, sig_count);
+    Tcl_Obj                      **parse_err = g_new0 (Tcl_Obj *, sig_count);
+    GHashTable                    *ep_cache  = g_hash_table_new_full (g_str_hash, g_str_equal, g_free, ig_tclc_endpoint_free);
+
+    /* parse all specifications, a failed specification is kept as an error message and skipped by the library */
+    for (int i = 0; i < sig_count; i++) {
+        int       arg_count = 0;
+        Tcl_Obj **arg_objs  = NULL;
+
+        result = Tcl_ListObjGetElements (interp, sig_objs[i], &arg_count, &arg_objs);
+        if (result == TCL_OK) {
+            /* argument parser skips command name */
+            Tcl_Obj **spec_objv = g_new (Tcl_Obj *, arg_count + 1);
+            spec_objv[0] = objv[0];
+            for (int j = 0; j < arg_count; j++) {
+                spec_objv[j+1] = arg_objs[j];
+            }
+
+            result = ig_tclc_connection_spec_parse (db, interp, arg_count + 1, spec_objv, &specs[i], &sizes[i], ep_cache);
+            g_free (spec_objv);
+        }
+
+        if (result != TCL_OK) {
+            parse_err[i] = Tcl_GetObjResult (interp);
+            Tcl_IncrRefCount (parse_err[i]);
+            Tcl_ResetResult (interp);
+            specs[i].signame = NULL;
+        }
     }
-    for (GList *li = trg_list; li != NULL; li = li->next) {
-        struct ig_lib_connection_info *trg = (struct ig_lib_connection_info *)li->data;
-        ig_lib_connection_info_free (trg);
+    g_hash_table_destroy (ep_cache);
+
+    /* hand only valid specifications to the library */
+    struct ig_lib_connection_spec *valid_specs = g_new0 (struct ig_lib_connection_spec, sig_count);
+    int                            valid_count = 0;
+
+    for (int i = 0; i < sig_count; i++) {
+        if (parse_err[i] != NULL) continue;
+        valid_specs[valid_count++] = specs[i];
     }
-    result = tcl_error_msg (interp, "Error: could not find object");
-    goto l_ig_tclc_connect_exit_pre;
+
+    log_debug ("TCCon", "starting connection of %d signals...", valid_count);
+    ig_lib_connection_batch (db, valid_specs, valid_count);
+    log_debug ("TCCon", "... finished connections");
+
+    Tcl_Obj *retval = Tcl_NewListObj (0, NULL);
+
+    for (int i = 0, vi = 0; i < sig_count; i++) {
+        Tcl_Obj *status[2];
+
+        if (parse_err[i] != NULL) {
+            status[0] = Tcl_NewStringObj ("error", -1);
+            status[1] = parse_err[i];
+        } else {
+            struct ig_lib_connection_spec *spec = &valid_specs[vi++];
+
+            if (spec->net == NULL) {
+                status[0] = Tcl_NewStringObj ("error", -1);
+                status[1] = Tcl_ObjPrintf ("Signal \"%s\": %s", spec->signame, (spec->error != NULL ? spec->error : "error while trying to create connection"));
+            } else {
+                ig_tclc_connection_set_size (spec->net, sizes[i]);
+                status[0] = Tcl_NewStringObj ("ok", -1);
+                status[1] = ig_tclc_objref_new (db, IG_OBJECT (spec->net));
+            }
+        }
+        Tcl_ListObjAppendElement (interp, retval, Tcl_NewListObj (2, status));
+        if (parse_err[i] != NULL) Tcl_DecrRefCount (parse_err[i]);
+    }
+
+    Tcl_SetObjResult (interp, retval);
+
+    g_free (valid_specs);
+    g_free (parse_err);
+    g_free (specs);
+    g_free (sizes);
+
+    return TCL_OK;
 }
 
 /* TCLDOC
@@ -1346,7 +2305,7 @@ static int ig_tclc_parameter (ClientData clientdata, Tcl_Interp *interp, int obj
     }
     log_debug ("TCPar", "... finished parametrization");
 
-    Tcl_Obj *retval = Tcl_NewStringObj (IG_OBJECT (gen_generic)->id, -1);
+    Tcl_Obj *retval = ig_tclc_objref_new (db, IG_OBJECT (gen_generic));
 
     log_debug ("TCPar", "freeing results...");
 
@@ -1445,108 +2404,734 @@ static int ig_tclc_create_pin (ClientData clientdata, Tcl_Interp *interp, int ob
 
     Tcl_Obj *retval = Tcl_NewListObj (0, NULL);
 
-    Tcl_ListObjAppendElement (interp, retval, Tcl_NewStringObj (IG_OBJECT (pin)->id, -1));
-    ig_obj_attr_set (IG_OBJECT (pin), "size", size, false);
+    Tcl_ListObjAppendElement (interp, retval, ig_tclc_objref_new (db, IG_OBJECT (pin)));
+    ig_obj_attr_set_by_key (IG_OBJECT (pin), IG_AK_SIZE, size, false);
     if (port != NULL) {
-        Tcl_ListObjAppendElement (interp, retval, Tcl_NewStringObj (IG_OBJECT (port)->id, -1));
-        ig_obj_attr_set (IG_OBJECT (port), "size", size, false);
+        Tcl_ListObjAppendElement (interp, retval, ig_tclc_objref_new (db, IG_OBJECT (port)));
+        ig_obj_attr_set_by_key (IG_OBJECT (port), IG_AK_SIZE, size, false);
     }
     Tcl_SetObjResult (interp, retval);
 
     return TCL_OK;
 }
-/* TCLDOC
-##
-# @brief Clear database of all objects.
-#
-# This removes everything from the database.
-# Can be useful to create multiple individual hierarchy sets with overlapping definitions one after another.
-#
-*/
-static int ig_tclc_reset (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[])
-{
-    struct ig_lib_db *db = (struct ig_lib_db *)clientdata;
 
-    if (db == NULL) return tcl_error_msg (interp,  "Database is NULL");
+/* regfile arraylist: register fields - name bit_high bit_low width entrybits type reset signal signalbits comment object */
+#define IG_TCLC_RF_REG_FIELDS 11
+/* regfile arraylist: register attributes - rf_width rf_entrybits rf_type rf_reset rf_signal rf_signalbits rf_comment */
+#define IG_TCLC_RF_REG_ATTRS  7
 
-    ig_lib_db_clear (db);
+/* regfile arraylist: common data and shared literals */
+struct ig_tclc_rf_context {
+    struct ig_lib_db *db;
+    Tcl_Interp       *interp;
 
-    return TCL_OK;
-}
+    const char  *wordsize;
+    Tcl_WideInt  wordsize_val;
 
-/* TCLDOC
-##
-# @brief Control log message verbosity.
-#
-# @param args <b> [OPTION]</b><br>
-#    <table style="border:0px; border-spacing:40px 0px;">
-#      <tr><td><b> OPTION </b></td><td><br></td></tr>
-#      <tr><td><i> &ensp; &ensp; -level  </i></td><td>  specify the loglevel  <br></td></tr>
-#      <tr><td><i> &ensp; &ensp; -id  </i></td><td>  specify the logid  <br></td></tr>
-#      <tr><td><i> &ensp; &ensp; -list  </i></td><td>  list available loglevels  <br></td></tr>
-#      <tr><td><i> &ensp; &ensp; -linenumber</i></td><td>  add file/line number to log-output (debug)  <br></td></tr>
-#      <tr><td><i> &ensp; &ensp; -nolinenumber</i></td><td>  do not add file/line number to log-output  <br></td></tr>
-#      <tr><td><i> &ensp; &ensp; -color</i></td><td>  enable colors in log-output  <br></td></tr>
-#      <tr><td><i> &ensp; &ensp; -nocolor</i></td><td>  disable colors in log-output  <br></td></tr>
-#    </table>
-#
-*/
-static int ig_tclc_logger (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[])
+    unsigned int  attr_keys[IG_TCLC_RF_REG_ATTRS];
+    Tcl_Obj      *attr_defaults[IG_TCLC_RF_REG_ATTRS];
+    Tcl_Obj      *reg_keys[IG_TCLC_RF_REG_FIELDS];
+    Tcl_Obj      *reserved;
+    Tcl_Obj      *empty;
+};
+
+/* regfile arraylist: register data before gap filling */
+struct ig_tclc_rf_reg_data {
+    Tcl_Obj     *fields[IG_TCLC_RF_REG_FIELDS];
+    Tcl_WideInt  bit_high;
+    Tcl_WideInt  bit_low;
+};
+
+/* regfile arraylist: processed entry with address for sorting */
+struct ig_tclc_rf_entry_data {
+    Tcl_Obj     *entry;
+    Tcl_WideInt  address;
+};
+
+static Tcl_Obj *ig_tclc_literal_new (const char *str)
 {
-    char    *loglevel   = NULL;
-    char    *log_id     = NULL;
-    gboolean list       = false;
-    int      linenumber = 0;
-    int      color      = 0;
+    Tcl_Obj *result = Tcl_NewStringObj (str, -1);
+    Tcl_IncrRefCount (result);
 
-    Tcl_ArgvInfo arg_table [] = {
-        {TCL_ARGV_STRING,   "-level",        NULL,                   (void *)&loglevel,   "log level",                                    NULL},
-        {TCL_ARGV_STRING,   "-id",           NULL,                   (void *)&log_id,     "log id",                                       NULL},
-        {TCL_ARGV_CONSTANT, "-list",         GINT_TO_POINTER (true), (void *)&list,       "list available loglevels",                     NULL},
-        {TCL_ARGV_CONSTANT, "-linenumber",   GINT_TO_POINTER (1),    (void *)&linenumber, "add file/line numbers to log-output",          NULL},
-        {TCL_ARGV_CONSTANT, "-nolinenumber", GINT_TO_POINTER (-1),   (void *)&linenumber, "do not print file/line numbers in log-output", NULL},
-        {TCL_ARGV_CONSTANT, "-color",        GINT_TO_POINTER (1),    (void *)&color,      "enable colors in log-output",                  NULL},
-        {TCL_ARGV_CONSTANT, "-nocolor",      GINT_TO_POINTER (-1),   (void *)&color,      "disable colors in log-output",                 NULL},
+    return result;
+}
 
-        TCL_ARGV_AUTO_HELP,
-        TCL_ARGV_TABLE_END
-    };
+static void ig_tclc_rf_context_init (struct ig_tclc_rf_context *ctx, struct ig_lib_db *db, Tcl_Interp *interp)
+{
+    const char *attr_names[IG_TCLC_RF_REG_ATTRS]    = {"rf_width", "rf_entrybits", "rf_type", "rf_reset", "rf_signal", "rf_signalbits", "rf_comment"};
+    const char *attr_defaults[IG_TCLC_RF_REG_ATTRS] = {"-1",       "",             "RW",      "-",        "-",         "-",             ""};
+    const char *reg_keys[IG_TCLC_RF_REG_FIELDS]     = {"name", "bit_high", "bit_low", "width", "entrybits", "type", "reset", "signal", "signalbits", "comment", "object"};
 
-    int result = Tcl_ParseArgsObjv (interp, arg_table, &objc, objv, NULL);
+    ctx->db     = db;
+    ctx->interp = interp;
 
-    if (result != TCL_OK) {
-        return result;
+    for (int i = 0; i < IG_TCLC_RF_REG_ATTRS; i++) {
+        ctx->attr_keys[i]     = ig_attr_key_lookup (attr_names[i]);
+        ctx->attr_defaults[i] = ig_tclc_literal_new (attr_defaults[i]);
     }
-
-    if (list) {
-        char *msg = g_strdup_printf ("The following loglevels are available:\n");
-        for (int i = 0; i < LOGLEVEL_COUNT; i++) {
-            char *tmp = g_strdup_printf ("%s\t- %s\n", msg, loglevel_label[i]);
-            g_free (msg);
-            msg = tmp;
-        }
-        Tcl_SetObjResult (interp, Tcl_NewStringObj ((char *)msg, -1));
-        g_free (msg);
-        return TCL_OK;
+    for (int i = 0; i < IG_TCLC_RF_REG_FIELDS; i++) {
+        ctx->reg_keys[i] = ig_tclc_literal_new (reg_keys[i]);
     }
+    ctx->reserved = ig_tclc_literal_new ("-");
+    ctx->empty    = ig_tclc_literal_new ("");
+}
 
-    if (linenumber) {
-        set_loglinenumbers ((linenumber > 0) ? true : false);
+static void ig_tclc_rf_context_clear (struct ig_tclc_rf_context *ctx)
+{
+    for (int i = 0; i < IG_TCLC_RF_REG_ATTRS; i++) {
+        Tcl_DecrRefCount (ctx->attr_defaults[i]);
     }
-    if (color) {
-        if (color > 0) {
-            colors_on ();
-        } else {
-            colors_off ();
-        }
+    for (int i = 0; i < IG_TCLC_RF_REG_FIELDS; i++) {
+        Tcl_DecrRefCount (ctx->reg_keys[i]);
     }
-    if (loglevel == NULL && log_id == NULL) {
-        // print current settings
-        if ((!linenumber) && (!color)) {
-            log_dump_settings ();
-        }
-        return TCL_OK;
-    } else if (loglevel != NULL) {
+    Tcl_DecrRefCount (ctx->reserved);
+    Tcl_DecrRefCount (ctx->empty);
+}
+
+static int ig_tclc_wide_int_parse (Tcl_Interp *interp, const char *str, int len, Tcl_WideInt *value)
+{
+    Tcl_Obj *obj = Tcl_NewStringObj (str, len);
+    Tcl_IncrRefCount (obj);
+    int result = Tcl_GetWideIntFromObj (interp, obj, value);
+    Tcl_DecrRefCount (obj);
+
+    return result;
+}
+
+static Tcl_Obj *ig_tclc_bitrange_new (Tcl_WideInt high, Tcl_WideInt low)
+{
+    char buf[48];
+
+    if (high == low) {
+        return Tcl_NewWideIntObj (high);
+    }
+    snprintf (buf, sizeof (buf), "%" TCL_LL_MODIFIER "d:%" TCL_LL_MODIFIER "d", high, low);
+
+    return Tcl_NewStringObj (buf, -1);
+}
+
+static gint ig_tclc_rf_reg_data_compare (gconstpointer a, gconstpointer b)
+{
+    const struct ig_tclc_rf_reg_data *ra = (const struct ig_tclc_rf_reg_data *)a;
+    const struct ig_tclc_rf_reg_data *rb = (const struct ig_tclc_rf_reg_data *)b;
+
+    return (ra->bit_low > rb->bit_low) - (ra->bit_low < rb->bit_low);
+}
+
+static gint ig_tclc_rf_entry_data_compare (gconstpointer a, gconstpointer b)
+{
+    const struct ig_tclc_rf_entry_data *ea = (const struct ig_tclc_rf_entry_data *)a;
+    const struct ig_tclc_rf_entry_data *eb = (const struct ig_tclc_rf_entry_data *)b;
+
+    return (ea->address > eb->address) - (ea->address < eb->address);
+}
+
+static void ig_tclc_rf_reg_data_free (gpointer data)
+{
+    struct ig_tclc_rf_reg_data *rd = (struct ig_tclc_rf_reg_data *)data;
+
+    for (int i = 0; i < IG_TCLC_RF_REG_FIELDS; i++) {
+        if (rd->fields[i] != NULL) Tcl_DecrRefCount (rd->fields[i]);
+    }
+    g_free (rd);
+}
+
+static void ig_tclc_rf_entry_data_free (gpointer data)
+{
+    struct ig_tclc_rf_entry_data *ed = (struct ig_tclc_rf_entry_data *)data;
+
+    Tcl_DecrRefCount (ed->entry);
+    g_free (ed);
+}
+
+static Tcl_Obj *ig_tclc_rf_reg_dict (struct ig_tclc_rf_context *ctx, Tcl_Obj **values)
+{
+    Tcl_Obj *elems[2*IG_TCLC_RF_REG_FIELDS];
+
+    for (int i = 0; i < IG_TCLC_RF_REG_FIELDS; i++) {
+        elems[2*i]   = ctx->reg_keys[i];
+        elems[2*i+1] = values[i];
+    }
+
+    return Tcl_NewListObj (2*IG_TCLC_RF_REG_FIELDS, elems);
+}
+
+/* reserved register covering unused bits high:low */
+static Tcl_Obj *ig_tclc_rf_reg_gap (struct ig_tclc_rf_context *ctx, Tcl_WideInt high, Tcl_WideInt low)
+{
+    Tcl_Obj *values[IG_TCLC_RF_REG_FIELDS] = {
+        ctx->reserved,
+        Tcl_NewWideIntObj (high),
+        Tcl_NewWideIntObj (low),
+        Tcl_NewWideIntObj (high - low + 1),
+        ig_tclc_bitrange_new (high, low),
+        ctx->reserved,
+        ctx->reserved,
+        ctx->reserved,
+        ctx->reserved,
+        ctx->empty,
+        ctx->empty,
+    };
+
+    return ig_tclc_rf_reg_dict (ctx, values);
+}
+
+/* attribute of register as shared Tcl_Obj, default literal if not set */
+static Tcl_Obj *ig_tclc_rf_reg_attr (struct ig_tclc_rf_context *ctx, struct ig_object *obj, int attr)
+{
+    const char *val = ig_obj_attr_get_by_key (obj, ctx->attr_keys[attr]);
+
+    Tcl_Obj *result = (val == NULL ? ctx->attr_defaults[attr] : Tcl_NewStringObj (val, -1));
+    Tcl_IncrRefCount (result);
+
+    return result;
+}
+
+/* process register of regfile entry into register data, tcl result is set in case of error */
+static struct ig_tclc_rf_reg_data *ig_tclc_rf_reg_data_new (struct ig_tclc_rf_context *ctx, struct ig_rf_reg *reg, Tcl_WideInt *next_bit)
+{
+    struct ig_object *obj = IG_OBJECT (reg);
+
+    struct ig_tclc_rf_reg_data *rd = g_new0 (struct ig_tclc_rf_reg_data, 1);
+
+    Tcl_Obj    *width_obj     = ig_tclc_rf_reg_attr (ctx, obj, 0);
+    Tcl_Obj    *entrybits_obj = ig_tclc_rf_reg_attr (ctx, obj, 1);
+    Tcl_WideInt width         = -1;
+
+    rd->fields[3] = width_obj;
+    rd->fields[4] = entrybits_obj;
+
+    if (Tcl_GetWideIntFromObj (ctx->interp, width_obj, &width) != TCL_OK) goto l_ig_tclc_rf_reg_data_new_error;
+
+    const char *entrybits = Tcl_GetString (entrybits_obj);
+    const char *colon     = strchr (entrybits, ':');
+
+    if (width < 0) {
+        if (entrybits[0] == '\0') {
+            rd->fields[3] = Tcl_NewStringObj (ctx->wordsize, -1);
+            rd->fields[4] = ig_tclc_bitrange_new (ctx->wordsize_val - 1, 0);
+        } else if (colon == NULL) {
+            rd->fields[3] = Tcl_NewWideIntObj (1);
+        } else {
+            Tcl_WideInt high;
+            Tcl_WideInt low;
+            const char *colon2 = strchr (colon + 1, ':');
+
+            if ((ig_tclc_wide_int_parse (ctx->interp, entrybits, colon - entrybits, &high) != TCL_OK)
+                || (ig_tclc_wide_int_parse (ctx->interp, colon + 1, (colon2 == NULL ? -1 : colon2 - colon - 1), &low) != TCL_OK)) {
+                goto l_ig_tclc_rf_reg_data_new_error;
+            }
+            rd->fields[3] = Tcl_NewWideIntObj (high - low + 1);
+        }
+    } else if (entrybits[0] == '\0') {
+        if (width == 1) {
+            rd->fields[4] = Tcl_NewWideIntObj (*next_bit);
+        } else {
+            rd->fields[4] = ig_tclc_bitrange_new (width + *next_bit - 1, *next_bit);
+        }
+    }
+    if (rd->fields[3] != width_obj) {
+        Tcl_IncrRefCount (rd->fields[3]);
+        Tcl_DecrRefCount (width_obj);
+    }
+    if (rd->fields[4] != entrybits_obj) {
+        Tcl_IncrRefCount (rd->fields[4]);
+        Tcl_DecrRefCount (entrybits_obj);
+    }
+
+    /* split final entrybits: high[:low] - like tcl split, a third element leaves low = high */
+    entrybits = Tcl_GetString (rd->fields[4]);
+    colon     = strchr (entrybits, ':');
+    if (colon == NULL) {
+        rd->fields[1] = rd->fields[4];
+        rd->fields[2] = rd->fields[4];
+    } else {
+        rd->fields[1] = Tcl_NewStringObj (entrybits, colon - entrybits);
+        rd->fields[2] = (strchr (colon + 1, ':') == NULL ? Tcl_NewStringObj (colon + 1, -1) : rd->fields[1]);
+    }
+    Tcl_IncrRefCount (rd->fields[1]);
+    Tcl_IncrRefCount (rd->fields[2]);
+
+    rd->fields[0]  = Tcl_NewStringObj (obj->name, -1);
+    rd->fields[10] = ig_tclc_objref_new (ctx->db, obj);
+    Tcl_IncrRefCount (rd->fields[0]);
+    Tcl_IncrRefCount (rd->fields[10]);
+    for (int i = 2; i < IG_TCLC_RF_REG_ATTRS; i++) {
+        rd->fields[3+i] = ig_tclc_rf_reg_attr (ctx, obj, i);
+    }
+
+    if ((Tcl_GetWideIntFromObj (ctx->interp, rd->fields[1], &rd->bit_high) != TCL_OK)
+        || (Tcl_GetWideIntFromObj (ctx->interp, rd->fields[2], &rd->bit_low) != TCL_OK)) {
+        goto l_ig_tclc_rf_reg_data_new_error;
+    }
+    *next_bit = rd->bit_high + 1;
+
+    return rd;
+
+l_ig_tclc_rf_reg_data_new_error:
+    ig_tclc_rf_reg_data_free (rd);
+    return NULL;
+}
+
+/* process regfile entry into arraylist, tcl result is set in case of error */
+static Tcl_Obj *ig_tclc_rf_entry_arraylist (struct ig_tclc_rf_context *ctx, struct ig_rf_entry *entry, const char **reg_name)
+{
+    struct ig_object *obj       = IG_OBJECT (entry);
+    Tcl_Interp       *interp    = ctx->interp;
+    GList            *reg_data  = NULL;
+    Tcl_WideInt       next_bit  = 0;
+    Tcl_WideInt       idx_start = -1;
+
+    for (GList *li = entry->regs->head; li != NULL; li = li->next) {
+        struct ig_rf_reg *reg = (struct ig_rf_reg *)li->data;
+
+        *reg_name = IG_OBJECT (reg)->name;
+
+        struct ig_tclc_rf_reg_data *rd = ig_tclc_rf_reg_data_new (ctx, reg, &next_bit);
+        if (rd == NULL) {
+            g_list_free_full (reg_data, ig_tclc_rf_reg_data_free);
+            return NULL;
+        }
+        reg_data = g_list_prepend (reg_data, rd);
+    }
+    /* g_list_sort is stable like lsort */
+    reg_data = g_list_sort (g_list_reverse (reg_data), ig_tclc_rf_reg_data_compare);
+
+    Tcl_Obj *reg_list = Tcl_NewListObj (0, NULL);
+
+    for (GList *li = reg_data; li != NULL; li = li->next) {
+        struct ig_tclc_rf_reg_data *rd = (struct ig_tclc_rf_reg_data *)li->data;
+
+        if (rd->bit_low - idx_start > 1) {
+            Tcl_ListObjAppendElement (interp, reg_list, ig_tclc_rf_reg_gap (ctx, rd->bit_low - 1, idx_start + 1));
+        }
+        Tcl_ListObjAppendElement (interp, reg_list, ig_tclc_rf_reg_dict (ctx, rd->fields));
+
+        idx_start = rd->bit_high;
+    }
+    if (idx_start < ctx->wordsize_val - 1) {
+        Tcl_ListObjAppendElement (interp, reg_list, ig_tclc_rf_reg_gap (ctx, ctx->wordsize_val - 1, idx_start + 1));
+    }
+    g_list_free_full (reg_data, ig_tclc_rf_reg_data_free);
+
+    const char *address = ig_obj_attr_get (obj, "address");
+    const char *comment = ig_obj_attr_get (obj, "comment");
+    const char *missing = (address == NULL ? "address" : (comment == NULL ? "comment" : NULL));
+
+    if (missing != NULL) {
+        Tcl_DecrRefCount (reg_list);
+        tcl_error_msg (interp, "Could not get attribute \"%s\" of object \"%s\"", missing, obj->id);
+        return NULL;
+    }
+
+    Tcl_Obj *result = Tcl_NewListObj (0, NULL);
+
+    Tcl_ListObjAppendElement (interp, result, Tcl_NewStringObj ("address", -1));
+    Tcl_ListObjAppendElement (interp, result, Tcl_NewStringObj (address, -1));
+    Tcl_ListObjAppendElement (interp, result, Tcl_NewStringObj ("comment", -1));
+    Tcl_ListObjAppendElement (interp, result, Tcl_NewStringObj (comment, -1));
+
+    for (unsigned int i = 0; i < obj->attributes.count; i++) {
+        struct ig_attribute *attr = &obj->attributes.data[i];
+        const char          *name = ig_attr_key_name (attr->key);
+
+        if (strcmp (name, "address") == 0) continue;
+        Tcl_ListObjAppendElement (interp, result, Tcl_NewStringObj (name, -1));
+        Tcl_ListObjAppendElement (interp, result, Tcl_NewStringObj (attr->value, -1));
+    }
+
+    Tcl_ListObjAppendElement (interp, result, Tcl_NewStringObj ("regs", -1));
+    Tcl_ListObjAppendElement (interp, result, reg_list);
+    Tcl_ListObjAppendElement (interp, result, ctx->reg_keys[10]);
+    Tcl_ListObjAppendElement (interp, result, ig_tclc_objref_new (ctx->db, obj));
+
+    return result;
+}
+
+/* TCLDOC
+##
+# @brief Return regfile entries and registers as array-list.
+#
+# Register bit ranges are completed and unused bits of each entry are filled with reserved registers.
+# Entries that cannot be processed are reported as error and skipped.
+# For a description of the result see @ref ig::templates::preprocess::regfile_to_arraylist.
+#
+# @param args Parsed command arguments:<br>
+# -of \<regfile-object-id\>
+#
+# @return List of entries sorted by address.
+*/
+static int ig_tclc_get_regfile_arraylist (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[])
+{
+    struct ig_lib_db *db = (struct ig_lib_db *)clientdata;
+
+    if (db == NULL) return tcl_error_msg (interp,  "Database is NULL");
+
+    Tcl_Obj *obj_ref = NULL;
+
+    Tcl_ArgvInfo arg_table [] = {
+        {TCL_ARGV_FUNC, "-of", (void *)(Tcl_ArgvFuncProc *)ig_tclc_tcl_obj_parse, (void *)&obj_ref, "regfile object id", NULL},
+
+        TCL_ARGV_AUTO_HELP,
+        TCL_ARGV_TABLE_END
+    };
+
+    int result = Tcl_ParseArgsObjv (interp, arg_table, &objc, objv, NULL);
+
+    if (result != TCL_OK) return result;
+
+    if (obj_ref == NULL) return tcl_error_msg (interp, "No regfile specified");
+
+    struct ig_object *obj = ig_tclc_objref_get (db, obj_ref);
+
+    if ((obj == NULL) || (obj->type != IG_OBJ_REGFILE)) {
+        return tcl_error_msg (interp, "Invalid regfile \"%s\"", Tcl_GetString (obj_ref));
+    }
+
+    struct ig_tclc_rf_context ctx;
+
+    ctx.wordsize = ig_obj_attr_get (obj, "datawidth");
+    if (ctx.wordsize == NULL) {
+        return tcl_error_msg (interp, "Could not get attribute \"datawidth\" of object \"%s\"", obj->id);
+    }
+    if (ig_tclc_wide_int_parse (interp, ctx.wordsize, -1, &ctx.wordsize_val) != TCL_OK) return TCL_ERROR;
+
+    ig_tclc_rf_context_init (&ctx, db, interp);
+
+    GList *entry_data = NULL;
+
+    for (GList *li = IG_RF_REGFILE (obj)->entries->head; li != NULL; li = li->next) {
+        struct ig_rf_entry *entry    = (struct ig_rf_entry *)li->data;
+        const char         *reg_name = "";
+
+        Tcl_Obj *entry_obj = ig_tclc_rf_entry_arraylist (&ctx, entry, &reg_name);
+
+        if (entry_obj == NULL) {
+            log_error ("RF", "Error while processing register \"%s/%s\" in regfile \"%s\" \n -- (%s) --\n%s",
+                       IG_OBJECT (entry)->name, reg_name, obj->name, IG_OBJECT (entry)->id, Tcl_GetStringResult (interp));
+            Tcl_ResetResult (interp);
+            continue;
+        }
+
+        struct ig_tclc_rf_entry_data *ed = g_new (struct ig_tclc_rf_entry_data, 1);
+        ed->entry = entry_obj;
+        Tcl_IncrRefCount (ed->entry);
+        entry_data = g_list_prepend (entry_data, ed);
+
+        /* address is second list element */
+        Tcl_Obj *address = NULL;
+        Tcl_ListObjIndex (NULL, entry_obj, 1, &address);
+        if (Tcl_GetWideIntFromObj (interp, address, &ed->address) != TCL_OK) {
+            result = TCL_ERROR;
+            break;
+        }
+    }
+
+    ig_tclc_rf_context_clear (&ctx);
+
+    if (result != TCL_OK) {
+        g_list_free_full (entry_data, ig_tclc_rf_entry_data_free);
+        return result;
+    }
+
+    entry_data = g_list_sort (g_list_reverse (entry_data), ig_tclc_rf_entry_data_compare);
+
+    Tcl_Obj *retval = Tcl_NewListObj (0, NULL);
+    for (GList *li = entry_data; li != NULL; li = li->next) {
+        struct ig_tclc_rf_entry_data *ed = (struct ig_tclc_rf_entry_data *)li->data;
+        Tcl_ListObjAppendElement (interp, retval, ed->entry);
+    }
+    g_list_free_full (entry_data, ig_tclc_rf_entry_data_free);
+
+    Tcl_SetObjResult (interp, retval);
+
+    return TCL_OK;
+}
+
+/* TCLDOC
+##
+# @brief Clear database of all objects.
+#
+# This removes everything from the database.
+# Can be useful to create multiple individual hierarchy sets with overlapping definitions one after another.
+#
+# @param args <b> [OPTION]</b><br>
+#    <table style="border:0px; border-spacing:40px 0px;">
+#      <tr><td><b> OPTION </b></td><td><br></td></tr>
+#      <tr><td><i> &ensp; &ensp; -arena    </i></td><td>  allocate subsequently created objects from an arena (faster creation and reset, no individual frees) <br></td></tr>
+#      <tr><td><i> &ensp; &ensp; -no-arena </i></td><td>  use individually refcounted objects (default) <br></td></tr>
+#    </table>
+*/
+static int ig_tclc_reset (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[])
+{
+    int arena = 0;
+
+    Tcl_ArgvInfo arg_table [] = {
+        {TCL_ARGV_CONSTANT, "-arena",    GINT_TO_POINTER (1),  (void *)&arena, "allocate objects from an arena",   NULL},
+        {TCL_ARGV_CONSTANT, "-no-arena", GINT_TO_POINTER (-1), (void *)&arena, "use individually refcounted objects", NULL},
+
+        TCL_ARGV_AUTO_HELP,
+        TCL_ARGV_TABLE_END
+    };
+
+    int result = Tcl_ParseArgsObjv (interp, arg_table, &objc, objv, NULL);
+
+    if (result != TCL_OK) {
+        return result;
+    }
+
+    struct ig_lib_db *db = (struct ig_lib_db *)clientdata;
+
+    if (db == NULL) return tcl_error_msg (interp,  "Database is NULL");
+
+    ig_lib_db_clear (db);
+
+    if (arena != 0) {
+        ig_lib_db_set_arena (db, (arena > 0));
+    }
+
+    return TCL_OK;
+}
+
+/* TCLDOC
+##
+# @brief Control log message verbosity.
+#
+# @param args <b> [OPTION]</b><br>
+#    <table style="border:0px; border-spacing:40px 0px;">
+#      <tr><td><b> OPTION </b></td><td><br></td></tr>
+#      <tr><td><i> &ensp; &ensp; -level  </i></td><td>  specify the loglevel  <br></td></tr>
+#      <tr><td><i> &ensp; &ensp; -id  </i></td><td>  specify the logid  <br></td></tr>
+#      <tr><td><i> &ensp; &ensp; -list  </i></td><td>  list available loglevels  <br></td></tr>
+#      <tr><td><i> &ensp; &ensp; -linenumber</i></td><td>  add file/line number to log-output (debug)  <br></td></tr>
+#      <tr><td><i> &ensp; &ensp; -nolinenumber</i></td><td>  do not add file/line number to log-output  <br></td></tr>
+#      <tr><td><i> &ensp; &ensp; -color</i></td><td>  enable colors in log-output  <br></td></tr>
+#      <tr><td><i> &ensp; &ensp; -nocolor</i></td><td>  disable colors in log-output  <br></td></tr>
+#    </table>
+#
+*/
+static int ig_tclc_logger (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[])
+{
+    char    *loglevel   = NULL;
+    char    *log_id     = NULL;
+    gboolean list       = false;
+    int      linenumber = 0;
+    int      color      = 0;
+
+    Tcl_ArgvInfo arg_table [] = {
+        {TCL_ARGV_STRING,   "-level",        NULL,                   (void *)&loglevel,   "log level",                                    NULL},
+        {TCL_ARGV_STRING,   "-id",           NULL,                   (void *)&log_id,     "log id",                                       NULL},
+        {TCL_ARGV_CONSTANT, "-list",         GINT_TO_POINTER (true), (void *)&list,       "list available loglevels",                     NULL},
+        {TCL_ARGV_CONSTANT, "-linenumber",   GINT_TO_POINTER (1),    (void *)&linenumber, "add file/line numbers to log-output",          NULL},
+        {TCL_ARGV_CONSTANT, "-nolinenumber", GINT_TO_POINTER (-1),   (void *)&linenumber, "do not print file/line numbers in log-output", NULL},
+        {TCL_ARGV_CONSTANT, "-color",        GINT_TO_POINTER (1),    (void *)&color,      "enable colors in log-output",                  NULL},
+        {TCL_ARGV_CONSTANT, "-nocolor",      GINT_TO_POINTER (-1),   (void *)&color,      "disable colors in log-output",                 NULL},
+
+        TCL_ARGV_AUTO_HELP,
+        TCL_ARGV_TABLE_END
+    };
+
+    int result = Tcl_ParseArgsObjv (interp, arg_table, &objc, objv, NULL);
+
+    if (result != TCL_OK) {
+        return result;
+    }
+
+    if (list) {
+        char *msg = g_strdup_printf ("The following loglevels are available:\n");
+        for (int i = 0; i < LOGLEVEL_COUNT; i++) {
+            char *tmp = g_strdup_printf ("%s\t- %s\n", msg, loglevel_label[i]);
+            g_free (msg);
+            msg = tmp;
+        }
+        Tcl_SetObjResult (interp, Tcl_NewStringObj ((char *)msg, -1));
+        g_free (msg);
+        return TCL_OK;
+    }
+
+    if (linenumber) {
+        set_loglinenumbers ((linenumber > 0) ? true : false);
+    }
+    if (color) {
+        if (color > 0) {
+            colors_on ();
+        } else {
+            colors_off ();
+        }
+    }
+    if (loglevel == NULL && log_id == NULL) {
+        // print current settings
+        if ((!linenumber) && (!color)) {
+            log_dump_settings ();
+        }
+        return TCL_OK;
+    } else if (loglevel != NULL) {
+        gboolean found_level = false;
+        int      i           = 0;
+        for (i = 0; i < LOGLEVEL_COUNT; i++) {
+            if (g_strcmp0 (loglevel, loglevel_label[i]) == 0) {
+                found_level = true;
+                break;
+            }
+        }
+        if (found_level) {
+            if (log_id != NULL) {
+                // set particular log level:
+                log_particular_level (log_id, i);
+                char *msg = g_strdup_printf ("Set logID %s loglevel to %s", log_id, loglevel);
+                Tcl_SetObjResult (interp, Tcl_NewStringObj ((char *)msg, -1));
+                g_free (msg);
+            } else {
+                // set default log level:
+                char *msg = g_strdup_printf ("Set default loglevel to %s", loglevel);
+                Tcl_SetObjResult (interp, Tcl_NewStringObj ((char *)msg, -1));
+                set_default_log_level (i);
+                g_free (msg);
+            }
+        } else {
+            // level does not exists:
+            return tcl_error_msg (interp, "Loglevel %s does not exist - try `-help` for a list of available loglevels", loglevel);
+        }
+    }
+
+    return TCL_OK;
+}
+
+/* TCLDOC
+##
+# @brief Control log message verbosity.
+#
+# @param args <b> [OPTION] LOGMESSAGE</b><br>
+#    <table style="border:0px; border-spacing:40px 0px;">
+#      <tr><td><b> LOGMESSAGE </b></td><td> specify the logmessage to be printed </td></tr>
+#      <tr><td><b> OPTION </b></td><td><br></td></tr>
+#      <tr><td><i> &ensp; &ensp; -id      </i></td><td>  specify the logid                 <br></td></tr>
+#      <tr><td><i> &ensp; &ensp; -debug   </i></td><td>  specify debug as max. loglevel    <br></td></tr>
+#      <tr><td><i> &ensp; &ensp; -info    </i></td><td>  specify info as max. loglevel     <br></td></tr>
+#      <tr><td><i> &ensp; &ensp; -warning </i></td><td>  specify warning as max. loglevel  <br></td></tr>
+#      <tr><td><i> &ensp; &ensp; -error   </i></td><td>  specify error as max. loglevel    <br></td></tr>
+#      <tr><td><i> &ensp; &ensp; -abort   </i></td><td>  throw TCL_ERROR                   <br></td></tr>
+#    </table>
+#
+*/
+static int ig_tclc_log (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[])
+{
+    char *log_id   = "Tcl";
+    gint  loglevel = LOGLEVEL_INFO;
+    gint  abort    = 0;
+
+    Tcl_ArgvInfo arg_table [] = {
+        {TCL_ARGV_STRING,   "-id",      NULL,                               (void *)&log_id,       "log id",                              NULL},
+        {TCL_ARGV_CONSTANT, "-debug",   GINT_TO_POINTER (LOGLEVEL_DEBUG),   (void *)&loglevel,     "loglevel debug",                      NULL},
+        {TCL_ARGV_CONSTANT, "-info",    GINT_TO_POINTER (LOGLEVEL_INFO),    (void *)&loglevel,     "loglevel info",                       NULL},
+        {TCL_ARGV_CONSTANT, "-warning", GINT_TO_POINTER (LOGLEVEL_WARNING), (void *)&loglevel,     "loglevel warning",                    NULL},
+        {TCL_ARGV_CONSTANT, "-error",   GINT_TO_POINTER (LOGLEVEL_ERROR),   (void *)&loglevel,     "loglevel error",                      NULL},
+        {TCL_ARGV_CONSTANT, "-abort",   GINT_TO_POINTER (1),                (void *)&abort,        "return the log message as tcl error", NULL},
+
+        TCL_ARGV_AUTO_HELP,
+        TCL_ARGV_TABLE_END
+    };
+
+    Tcl_Obj **remObjv = NULL;
+    int       result  = Tcl_ParseArgsObjv (interp, arg_table, &objc, objv, &remObjv);
+
+    if (result != TCL_OK) {
+        if (objc != 0) ckfree (remObjv);
+        return result;
+    }
+
+    char *msg = "";
+
+    if (objc > 0) {
+        for (int i = 1; i < objc; i++) {
+            msg = Tcl_GetString (remObjv[i]);
+            char *file       = "TCL-Unknown";
+            char *cmd        = NULL;
+            int   linenumber = 0;
+
+            if (log_enabled (loglevel, log_id)) {
+                if (Tcl_Eval (interp, "info frame -1") == TCL_OK) {
+                    Tcl_Obj *dict_info_frame = Tcl_GetObjResult (interp);
+
+                    if (!tcl_dict_get_str (interp, dict_info_frame, "file", &file)) {
+                        if (tcl_dict_get_str (interp, dict_info_frame, "cmd", &cmd)) {
+                            cmd  = g_strdup_printf ("TCL-CMD(%s)", cmd);
+                            file = cmd;
+                        } else if (tcl_dict_get_str (interp, dict_info_frame, "proc", &cmd)) {
+                            cmd  = g_strdup_printf ("TCL-PROC(%s)", cmd);
+                            file = cmd;
+                        }
+                    }
+
+                    if (get_loglinenumbers ()) {
+                        tcl_dict_get_int (interp, dict_info_frame, "line", &linenumber);
+                    }
+                }
+            }
+
+            log_base (loglevel, log_id, basename (file), linenumber, "%s", msg);
+            g_free (cmd);
+        }
+    }
+
+    if (abort) {
+        Tcl_SetObjResult (interp, Tcl_NewStringObj (msg, -1));
+    }
+
+    if (objc != 0) ckfree (remObjv);
+
+    if (abort) return TCL_ERROR;
+    return TCL_OK;
+}
+
+/* TCLDOC
+##
+# @brief Control log message verbosity.
+#
+# @param args <b> [OPTION]</b><br>
+#    <table style="border:0px; border-spacing:40px 0px;">
+#      <tr><td><b> OPTION </b></td><td><br></td></tr>
+#      <tr><td><i> &ensp; &ensp; -level  </i></td><td>  specify the loglevel  <br></td></tr>
+#      <tr><td><i> &ensp; &ensp; -suppress  </i></td><td>  get number of suppressed log messages  <br></td></tr>
+#      <tr><td><i> &ensp; &ensp; -add  </i></td><td>  add given number of messages to statistics of specified loglevel (e.g. generated by other processes) <br></td></tr>
+#    </table>
+#
+*/
+static int ig_tclc_log_stat (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[])
+{
+    char *loglevel = NULL;
+    gint  suppress = 0;
+    gint  add      = -1;
+
+    Tcl_ArgvInfo arg_table [] = {
+        {TCL_ARGV_STRING,   "-level",    NULL,                (void *)&loglevel, "log level",                                    NULL},
+        {TCL_ARGV_CONSTANT, "-suppress", GINT_TO_POINTER (1), (void *)&suppress, "return the log message as tcl error", NULL},
+        {TCL_ARGV_INT,      "-add",      NULL,                (void *)&add,      "add number of messages to statistics",         NULL},
+
+        TCL_ARGV_AUTO_HELP,
+        TCL_ARGV_TABLE_END
+    };
+
+    int result = Tcl_ParseArgsObjv (interp, arg_table, &objc, objv, NULL);
+
+    if (result != TCL_OK) {
+        return result;
+    }
+
+    Tcl_Obj *retval = NULL;
+
+    if ((add >= 0) && (loglevel == NULL)) {
+        return tcl_error_msg (interp, "-add requires a loglevel");
+    }
+
+    if (loglevel == NULL) {
+        retval = Tcl_NewListObj (0, NULL);
+        for (int i = 0; i < LOGLEVEL_COUNT; i++) {
+            Tcl_ListObjAppendElement (interp, retval, Tcl_NewStringObj (loglevel_label[i], -1));
+            Tcl_Obj *log_count = Tcl_NewIntObj (suppress ? get_log_count_suppressed (i) : get_log_count_print (i));
+            Tcl_ListObjAppendElement (interp, retval, log_count);
+        }
+    } else if (loglevel != NULL) {
         gboolean found_level = false;
         int      i           = 0;
         for (i = 0; i < LOGLEVEL_COUNT; i++) {
@@ -1555,187 +3140,1590 @@ static int ig_tclc_logger (ClientData clientdata, Tcl_Interp *interp, int objc,
                 break;
             }
         }
-        if (found_level) {
-            if (log_id != NULL) {
-                // set particular log level:
-                log_particular_level (log_id, i);
-                char *msg = g_strdup_printf ("Set logID %s loglevel to %s", log_id, loglevel);
-                Tcl_SetObjResult (interp, Tcl_NewStringObj ((char *)msg, -1));
-                g_free (msg);
-            } else {
-                // set default log level:
-                char *msg = g_strdup_printf ("Set default loglevel to %s", loglevel);
-                Tcl_SetObjResult (interp, Tcl_NewStringObj ((char *)msg, -1));
-                set_default_log_level (i);
-                g_free (msg);
+        if (found_level) {
+            if (add >= 0) {
+                log_count_add (i, add, suppress);
+            }
+            retval = Tcl_NewIntObj (suppress ? get_log_count_suppressed (i) : get_log_count_print (i));
+        } else {
+            // level does not exists:
+            return tcl_error_msg (interp, "Loglevel %s does not exist - try `-help` for a list of available loglevels", loglevel);
+        }
+    }
+
+    Tcl_SetObjResult (interp, retval);
+    return TCL_OK;
+}
+
+/* TCLDOC
+##
+# @brief print the icglue logo
+#
+*/
+static int ig_tclc_print_logo (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[])
+{
+    ig_print_logo (stderr);
+    return TCL_OK;
+}
+
+/* find needle in text of given length starting at pos, returns position or -1 */
+static int ig_tclc_text_find (const char *text, int text_len, int pos, const char *needle, int needle_len)
+{
+    if (needle_len <= 0) return -1;
+
+    while (pos + needle_len <= text_len) {
+        const char *c = memchr (text + pos, needle[0], text_len - pos - needle_len + 1);
+        if (c == NULL) return -1;
+
+        pos = c - text;
+        if (memcmp (c, needle, needle_len) == 0) return pos;
+        pos++;
+    }
+
+    return -1;
+}
+
+/* TCLDOC
+##
+# @brief Extract keep blocks of an existing generated output.
+#
+# @param args <b> -text &lt;text&gt; -lexcom {&lt;comment-begin&gt; &lt;comment-end&gt;}</b><br>
+#    <table style="border:0px; border-spacing:40px 0px;">
+#      <tr><td><b> text </b></td><td> content of existing output <br></td></tr>
+#      <tr><td><b> lexcom </b></td><td> comment begin and end token of output language as returned by @ref ig::templates::comment_begin_end <br></td></tr>
+#    </table>
+#
+# @return dict with a list of block main type and sub type as key and a list of blocks
+#   of this type as value, each block as list of its index in the text and its content.
+#
+# Blocks are of the form <tt>&lt;comment-begin&gt;icglue &lt;maintype&gt; begin &lt;subtype&gt;&lt;comment-end&gt;</tt>
+# ... <tt>&lt;comment-begin&gt;icglue &lt;maintype&gt; end&lt;comment-end&gt;</tt>
+# (or with "pragma icglue" for compatibility), currently only @c keep is supported as maintype.
+# The text is scanned once, blocks of the same type are kept in the order of their occurrence.
+*/
+static int ig_tclc_extract_keep_blocks (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[])
+{
+    Tcl_Obj *text_obj   = NULL;
+    Tcl_Obj *lexcom_obj = NULL;
+
+    Tcl_ArgvInfo arg_table [] = {
+        {TCL_ARGV_FUNC, "-text",   (void *)(Tcl_ArgvFuncProc *)ig_tclc_tcl_obj_parse, (void *)&text_obj,   "text to parse", NULL},
+        {TCL_ARGV_FUNC, "-lexcom", (void *)(Tcl_ArgvFuncProc *)ig_tclc_tcl_obj_parse, (void *)&lexcom_obj, "comment begin and end token", NULL},
+
+        TCL_ARGV_AUTO_HELP,
+        TCL_ARGV_TABLE_END
+    };
+
+    int result = Tcl_ParseArgsObjv (interp, arg_table, &objc, objv, NULL);
+    if (result != TCL_OK) {
+        return result;
+    }
+
+    if ((text_obj == NULL) || (lexcom_obj == NULL)) {
+        return tcl_error_msg (interp, "text and comment tokens must be specified");
+    }
+
+    int       lexcom_len = 0;
+    Tcl_Obj **lexcom_elems;
+    if (Tcl_ListObjGetElements (interp, lexcom_obj, &lexcom_len, &lexcom_elems) != TCL_OK) {
+        return TCL_ERROR;
+    }
+
+    int         cbegin_len = 0;
+    int         cend_len   = 0;
+    const char *cbegin     = (lexcom_len > 0 ? Tcl_GetStringFromObj (lexcom_elems[0], &cbegin_len) : "");
+    const char *cend       = (lexcom_len > 1 ? Tcl_GetStringFromObj (lexcom_elems[1], &cend_len) : "");
+
+    int         text_len = 0;
+    const char *text     = Tcl_GetStringFromObj (text_obj, &text_len);
+
+    /* compatibility: accept comments with "pragma" */
+    const char *pfx         = "";
+    GString    *block_start = g_string_new (NULL);
+    GString    *block_end   = g_string_new (NULL);
+
+    g_string_printf (block_start, "%spragma icglue keep begin ", cbegin);
+    if (ig_tclc_text_find (text, text_len, 0, block_start->str, block_start->len) >= 0) {
+        pfx = "pragma ";
+    }
+    g_string_printf (block_start, "%s%sicglue keep begin ", cbegin, pfx);
+    g_string_printf (block_end, "%s%sicglue keep end%s", cbegin, pfx, cend);
+
+    Tcl_Obj *retval = Tcl_NewDictObj ();
+    Tcl_Obj *keep   = Tcl_NewStringObj ("keep", -1);
+    Tcl_IncrRefCount (retval);
+    Tcl_IncrRefCount (keep);
+
+    int pos       = 0;
+    int block_idx = 0;
+    int i;
+    while ((i = ig_tclc_text_find (text, text_len, pos, block_start->str, block_start->len)) >= 0) {
+        i += block_start->len;
+
+        int j = ig_tclc_text_find (text, text_len, i, cend, cend_len);
+        if (j < 0) {
+            result = tcl_error_msg (interp, "No end of icglue keep comment");
+            goto l_ig_tclc_extract_keep_blocks_exit;
+        }
+
+        int type_pos = i;
+        int type_len = j - i;
+        pos = j + cend_len;
+
+        int k = ig_tclc_text_find (text, text_len, pos, block_end->str, block_end->len);
+        if (k < 0) {
+            result = tcl_error_msg (interp, "No end of block after keep block begin - pragma type was %.*s", type_len, text + type_pos);
+            goto l_ig_tclc_extract_keep_blocks_exit;
+        }
+
+        Tcl_Obj *key_elems[2]   = {keep, Tcl_NewStringObj (text + type_pos, type_len)};
+        Tcl_Obj *key            = Tcl_NewListObj (2, key_elems);
+        Tcl_Obj *block_elems[2] = {Tcl_NewIntObj (block_idx++), Tcl_NewStringObj (text + pos, k - pos)};
+        Tcl_Obj *blocks         = NULL;
+        Tcl_IncrRefCount (key);
+        Tcl_DictObjGet (NULL, retval, key, &blocks);
+        if (blocks == NULL) {
+            blocks = Tcl_NewListObj (0, NULL);
+        }
+        Tcl_ListObjAppendElement (NULL, blocks, Tcl_NewListObj (2, block_elems));
+        Tcl_DictObjPut (NULL, retval, key, blocks);
+        Tcl_DecrRefCount (key);
+        pos = k + block_end->len;
+    }
+
+    Tcl_SetObjResult (interp, retval);
+
+l_ig_tclc_extract_keep_blocks_exit:
+    Tcl_DecrRefCount (keep);
+    Tcl_DecrRefCount (retval);
+    g_string_free (block_start, TRUE);
+    g_string_free (block_end, TRUE);
+
+    return result;
+}
+
+/* template lexer helpers: append list of objects in its Tcl string representation to code */
+static void ig_tclc_code_append_list (Tcl_Obj *code, int objc, Tcl_Obj *const objv[])
+{
+    Tcl_Obj *list = Tcl_NewListObj (objc, objv);
+    Tcl_IncrRefCount (list);
+
+    int         len = 0;
+    const char *str = Tcl_GetStringFromObj (list, &len);
+    Tcl_AppendToObj (code, str, len);
+
+    Tcl_DecrRefCount (list);
+}
+
+/* template lexer helpers: append text range as single quoted list element to code */
+static void ig_tclc_code_append_elem (Tcl_Obj *code, const char *text, int len)
+{
+    Tcl_Obj *elem = Tcl_NewStringObj (text, (len > 0 ? len : 0));
+    ig_tclc_code_append_list (code, 1, &elem);
+}
+
+/* template lexer helpers: append "_filename <filename>\n_linenr <linenr>\n" to code */
+static void ig_tclc_code_append_pos (Tcl_Obj *code, Tcl_Obj *filename, int linenr)
+{
+    Tcl_AppendToObj (code, "_filename ", -1);
+    ig_tclc_code_append_list (code, 1, &filename);
+    Tcl_AppendPrintfToObj (code, "\n_linenr %d\n", linenr);
+}
+
+/* template lexer helpers: number of newlines in text range */
+static int ig_tclc_count_nl (const char *text, int len)
+{
+    int         count = 0;
+    const char *end   = text + len;
+
+    while ((len > 0) && ((text = memchr (text, '\n', end - text)) != NULL)) {
+        count++;
+        text++;
+    }
+
+    return count;
+}
+
+/*
+ * version of the template lexers (icgt and wtf):
+ * part of the persistent template cache key - increase on every change of generated code
+ */
+#define IG_TCLC_TEMPLATE_LEXER_VERSION 1
+
+/* TCLDOC
+##
+# @brief Version of the native template lexers.
+#
+# @return Version number - changes whenever code generated by @ref ig::util::template_lex_icgt or @ref ig::util::template_lex_wtf changes.
+*/
+static int ig_tclc_template_lexer_version (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[])
+{
+    if (objc != 1) {
+        Tcl_WrongNumArgs (interp, 1, objv, NULL);
+        return TCL_ERROR;
+    }
+
+    Tcl_SetObjResult (interp, Tcl_NewIntObj (IG_TCLC_TEMPLATE_LEXER_VERSION));
+    return TCL_OK;
+}
+
+/* icgt lexer: position in (included) template */
+struct ig_tclc_icgt_frame {
+    Tcl_Obj *filename;
+    Tcl_Obj *text;
+    int      pos;
+    int      linenr;
+};
+
+static struct ig_tclc_icgt_frame *ig_tclc_icgt_frame_new (Tcl_Obj *filename, Tcl_Obj *text, int pos, int linenr)
+{
+    struct ig_tclc_icgt_frame *frame = g_new0 (struct ig_tclc_icgt_frame, 1);
+
+    frame->filename = filename;
+    frame->text     = text;
+    frame->pos      = pos;
+    frame->linenr   = linenr;
+    Tcl_IncrRefCount (filename);
+    Tcl_IncrRefCount (text);
+
+    return frame;
+}
+
+static void ig_tclc_icgt_frame_free (struct ig_tclc_icgt_frame *frame)
+{
+    if (frame == NULL) return;
+
+    Tcl_DecrRefCount (frame->filename);
+    Tcl_DecrRefCount (frame->text);
+    g_free (frame);
+}
+
+/* TCLDOC
+##
+# @brief Translate icgt template to Tcl code (internal lexer of @ref ig::templates::parse_template).
+#
+# @param args <b> -text &lt;text&gt; -filename &lt;filename&gt; -includecmd &lt;cmdprefix&gt;</b><br>
+#    <table style="border:0px; border-spacing:40px 0px;">
+#      <tr><td><b> text </b></td><td> template content <br></td></tr>
+#      <tr><td><b> filename </b></td><td> template file name for _filename tracking <br></td></tr>
+#      <tr><td><b> cmdprefix </b></td><td> command prefix called for &lt;%I ... %&gt; include tags <br></td></tr>
+#    </table>
+#
+# @return Tcl code generated from template.
+#
+# For includes, @c cmdprefix is called with the raw include tag content and the list of files
+# currently being parsed. It has to return a list of the included file name and its content.
+*/
+static int ig_tclc_template_lex_icgt (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[])
+{
+    Tcl_Obj *text_obj     = NULL;
+    Tcl_Obj *filename_obj = NULL;
+    Tcl_Obj *include_cmd  = NULL;
+
+    Tcl_ArgvInfo arg_table [] = {
+        {TCL_ARGV_FUNC, "-text",       (void *)(Tcl_ArgvFuncProc *)ig_tclc_tcl_obj_parse, (void *)&text_obj,     "template text", NULL},
+        {TCL_ARGV_FUNC, "-filename",   (void *)(Tcl_ArgvFuncProc *)ig_tclc_tcl_obj_parse, (void *)&filename_obj, "template file name", NULL},
+        {TCL_ARGV_FUNC, "-includecmd", (void *)(Tcl_ArgvFuncProc *)ig_tclc_tcl_obj_parse, (void *)&include_cmd,  "include callback", NULL},
+
+        TCL_ARGV_AUTO_HELP,
+        TCL_ARGV_TABLE_END
+    };
+
+    int result = Tcl_ParseArgsObjv (interp, arg_table, &objc, objv, NULL);
+    if (result != TCL_OK) {
+        return result;
+    }
+
+    if ((text_obj == NULL) || (include_cmd == NULL)) {
+        return tcl_error_msg (interp, "template text and include command must be specified");
+    }
+    if (filename_obj == NULL) {
+        filename_obj = Tcl_NewObj ();
+    }
+
+    Tcl_Obj   *code  = Tcl_NewObj ();
+    GPtrArray *stack = g_ptr_array_new ();
+    Tcl_IncrRefCount (code);
+
+    g_ptr_array_add (stack, ig_tclc_icgt_frame_new (filename_obj, text_obj, 0, 1));
+
+    struct ig_tclc_icgt_frame *frame = NULL;
+
+    while (stack->len > 0) {
+        frame = g_ptr_array_index (stack, stack->len - 1);
+        g_ptr_array_set_size (stack, stack->len - 1);
+
+        ig_tclc_code_append_pos (code, frame->filename, frame->linenr);
+
+        int         len = 0;
+        const char *txt = Tcl_GetStringFromObj (frame->text, &len);
+        int         p   = frame->pos;
+
+        while (true) {
+            /* search opening delimiter: <% or <[ with optional chomp */
+            int d = p;
+            while ((d = ig_tclc_text_find (txt, len, d, "<", 1)) >= 0) {
+                if ((d + 1 < len) && ((txt[d+1] == '%') || (txt[d+1] == '['))) break;
+                d++;
+            }
+            if (d < 0) break;
+
+            char opening = txt[d+1];
+            int  d_end   = d + 1;
+            char chomp   = '\0';
+            if ((d + 2 < len) && ((txt[d+2] == '+') || (txt[d+2] == '-'))) {
+                chomp = txt[d+2];
+                d_end = d + 2;
+            }
+
+            /* verbatim content with right chomp */
+            int right_end = d;
+            if ((chomp == '-') && (d - 1 >= p) && (txt[d-1] == '\n')) {
+                right_end--;
+            }
+
+            frame->linenr += ig_tclc_count_nl (txt + p, d_end + 1 - p);
+            Tcl_AppendPrintfToObj (code, "_linenr %d\necho ", frame->linenr);
+            ig_tclc_code_append_elem (code, txt + p, right_end - p);
+            Tcl_AppendToObj (code, "\n", 1);
+            p = d_end + 1;
+
+            bool        incltag       = false;
+            const char *closing_delim = "]>";
+            if (opening == '%') {
+                closing_delim = "%>";
+                if ((p < len) && (txt[p] == '=')) {
+                    /* <%= will be be append, but evaluated as tcl-argument */
+                    Tcl_AppendToObj (code, "echo ", -1);
+                    p++;
+                } else if ((p < len) && (txt[p] == 'I')) {
+                    /* <%I will be included here */
+                    incltag = true;
+                    p++;
+                }
+            } else {
+                /* closing delimiter is closing square bracket */
+                Tcl_AppendToObj (code, "echo [ ", -1);
+            }
+
+            /* search closing delimiter */
+            int c = ig_tclc_text_find (txt, len, p, closing_delim, 2);
+            if (c < 0) {
+                Tcl_SetObjResult (interp, Tcl_ObjPrintf ("No matching %s", closing_delim));
+                result = TCL_ERROR;
+                goto l_ig_tclc_template_lex_icgt_exit;
+            }
+            int left    = c + 2;
+            int content = c;
+            /* check for left chomp */
+            if ((c - 1 >= p) && ((txt[c-1] == '-') || (txt[c-1] == '+'))) {
+                if ((txt[c-1] == '-') && (left < len) && (txt[left] == '\n')) {
+                    left++;
+                }
+                content--;
+            }
+
+            frame->linenr += ig_tclc_count_nl (txt + p, left - p);
+
+            if (incltag) {
+                /* callback: include spec, files on stack (including current) */
+                Tcl_Obj *files = Tcl_NewListObj (0, NULL);
+                for (guint i = 0; i < stack->len; i++) {
+                    struct ig_tclc_icgt_frame *i_frame = g_ptr_array_index (stack, i);
+                    Tcl_ListObjAppendElement (NULL, files, i_frame->filename);
+                }
+                Tcl_ListObjAppendElement (NULL, files, frame->filename);
+
+                Tcl_Obj *cmd = Tcl_DuplicateObj (include_cmd);
+                Tcl_IncrRefCount (cmd);
+                Tcl_ListObjAppendElement (NULL, cmd, Tcl_NewStringObj (txt + p, content - p));
+                Tcl_ListObjAppendElement (NULL, cmd, files);
+                result = Tcl_EvalObjEx (interp, cmd, 0);
+                Tcl_DecrRefCount (cmd);
+                if (result != TCL_OK) goto l_ig_tclc_template_lex_icgt_exit;
+
+                Tcl_Obj *inc_res = Tcl_GetObjResult (interp);
+                int      inc_len = 0;
+                Tcl_Obj **inc_elems;
+                if ((Tcl_ListObjGetElements (interp, inc_res, &inc_len, &inc_elems) != TCL_OK) || (inc_len != 2)) {
+                    result = tcl_error_msg (interp, "include command has to return file name and content");
+                    goto l_ig_tclc_template_lex_icgt_exit;
+                }
+
+                /* continue with included file, current file is continued afterwards */
+                frame->pos = left;
+                g_ptr_array_add (stack, frame);
+                frame = ig_tclc_icgt_frame_new (inc_elems[0], inc_elems[1], 0, 1);
+                Tcl_ResetResult (interp);
+
+                txt = Tcl_GetStringFromObj (frame->text, &len);
+                p   = 0;
+            } else {
+                Tcl_AppendToObj (code, txt + p, content - p);
+                Tcl_AppendToObj (code, (opening == '%' ? " \n" : " ]\n"), -1);
+                p = left;
+            }
+            ig_tclc_code_append_pos (code, frame->filename, frame->linenr);
+        }
+
+        /* remainder of verbatim content */
+        if (p < len) {
+            Tcl_AppendToObj (code, "echo ", -1);
+            ig_tclc_code_append_elem (code, txt + p, len - p);
+            Tcl_AppendToObj (code, "\n", 1);
+        }
+
+        ig_tclc_icgt_frame_free (frame);
+        frame = NULL;
+    }
+
+    Tcl_SetObjResult (interp, code);
+
+l_ig_tclc_template_lex_icgt_exit:
+    ig_tclc_icgt_frame_free (frame);
+    for (guint i = 0; i < stack->len; i++) {
+        ig_tclc_icgt_frame_free (g_ptr_array_index (stack, i));
+    }
+    g_ptr_array_free (stack, TRUE);
+    Tcl_DecrRefCount (code);
+
+    return result;
+}
+
+/* wtf lexer: append echo of raw text with subst according to substmode, returns number of newlines in text */
+static int ig_tclc_wtf_append_raw (Tcl_Obj *code, Tcl_Obj *substmode, const char *text, int len, int linenr)
+{
+    int       mode_len = 0;
+    Tcl_Obj **mode_elems;
+    Tcl_ListObjGetElements (NULL, substmode, &mode_len, &mode_elems);
+
+    Tcl_Obj *subst = Tcl_NewListObj (0, NULL);
+    Tcl_IncrRefCount (subst);
+    Tcl_ListObjAppendElement (NULL, subst, Tcl_NewStringObj ("subst", -1));
+    for (int i = 0; i < mode_len; i++) {
+        Tcl_ListObjAppendElement (NULL, subst, mode_elems[i]);
+    }
+    Tcl_ListObjAppendElement (NULL, subst, Tcl_NewStringObj (text, len));
+
+    int         subst_len = 0;
+    const char *subst_str = Tcl_GetStringFromObj (subst, &subst_len);
+
+    Tcl_AppendPrintfToObj (code, "_linenr %d\necho \"[", linenr);
+    Tcl_AppendToObj (code, subst_str, subst_len);
+    Tcl_AppendToObj (code, "]\"\n", -1);
+    Tcl_DecrRefCount (subst);
+
+    return ig_tclc_count_nl (text, len);
+}
+
+/* TCLDOC
+##
+# @brief Translate wtf template to Tcl code (internal lexer of @ref ig::templates::parse_wtf).
+#
+# @param args <b> -text &lt;text&gt; -filename &lt;filename&gt; -filestack &lt;files&gt; -directivecmd &lt;cmdprefix&gt;</b><br>
+#    <table style="border:0px; border-spacing:40px 0px;">
+#      <tr><td><b> text </b></td><td> template content <br></td></tr>
+#      <tr><td><b> filename </b></td><td> template file name for _filename tracking <br></td></tr>
+#      <tr><td><b> files </b></td><td> list of files including this template <br></td></tr>
+#      <tr><td><b> cmdprefix </b></td><td> command prefix called for %I(...) and %M(...) lines <br></td></tr>
+#    </table>
+#
+# @return Tcl code generated from template.
+#
+# For include/subst mode lines, @c cmdprefix is called with the line, the file name, the current line number,
+# the file stack including this file and the current subst mode.
+# It has to return a list of Tcl code to insert and the new subst mode.
+*/
+static int ig_tclc_template_lex_wtf (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[])
+{
+    Tcl_Obj *text_obj      = NULL;
+    Tcl_Obj *filename_obj  = NULL;
+    Tcl_Obj *filestack_obj = NULL;
+    Tcl_Obj *directive_cmd = NULL;
+
+    Tcl_ArgvInfo arg_table [] = {
+        {TCL_ARGV_FUNC, "-text",         (void *)(Tcl_ArgvFuncProc *)ig_tclc_tcl_obj_parse, (void *)&text_obj,      "template text", NULL},
+        {TCL_ARGV_FUNC, "-filename",     (void *)(Tcl_ArgvFuncProc *)ig_tclc_tcl_obj_parse, (void *)&filename_obj,  "template file name", NULL},
+        {TCL_ARGV_FUNC, "-filestack",    (void *)(Tcl_ArgvFuncProc *)ig_tclc_tcl_obj_parse, (void *)&filestack_obj, "files including this template", NULL},
+        {TCL_ARGV_FUNC, "-directivecmd", (void *)(Tcl_ArgvFuncProc *)ig_tclc_tcl_obj_parse, (void *)&directive_cmd, "include/subst mode callback", NULL},
+
+        TCL_ARGV_AUTO_HELP,
+        TCL_ARGV_TABLE_END
+    };
+
+    int result = Tcl_ParseArgsObjv (interp, arg_table, &objc, objv, NULL);
+    if (result != TCL_OK) {
+        return result;
+    }
+
+    if ((text_obj == NULL) || (directive_cmd == NULL)) {
+        return tcl_error_msg (interp, "template text and directive command must be specified");
+    }
+    if (filename_obj == NULL) {
+        filename_obj = Tcl_NewObj ();
+    }
+
+    Tcl_Obj *code      = Tcl_NewObj ();
+    Tcl_Obj *substmode = Tcl_NewObj ();
+    Tcl_Obj *filestack = (filestack_obj != NULL ? Tcl_DuplicateObj (filestack_obj) : Tcl_NewListObj (0, NULL));
+    Tcl_IncrRefCount (code);
+    Tcl_IncrRefCount (substmode);
+    Tcl_IncrRefCount (filestack);
+    Tcl_IncrRefCount (text_obj);
+    Tcl_IncrRefCount (filename_obj);
+
+    if (Tcl_ListObjAppendElement (interp, filestack, filename_obj) != TCL_OK) {
+        result = TCL_ERROR;
+        goto l_ig_tclc_template_lex_wtf_exit;
+    }
+
+    int         len    = 0;
+    const char *txt    = Tcl_GetStringFromObj (text_obj, &len);
+    int         pos    = 0;
+    int         linenr = 1;
+    bool        block  = false;
+
+    ig_tclc_code_append_pos (code, filename_obj, linenr);
+
+    /* all lines starting with % */
+    for (int from = 0; from < len; ) {
+        const char *eol_ptr = memchr (txt + from, '\n', len - from);
+        int         eol     = (eol_ptr != NULL ? eol_ptr - txt : len);
+        int         next    = eol + 1;
+
+        if (txt[from] != '%') {
+            from = next;
+            continue;
+        }
+        int to = eol - 1;
+
+        if (block) {
+            /* inside %( ... %) */
+            if ((from + 1 < len) && (txt[from+1] == ')')) {
+                /* block ends */
+                if (to >= from + 2) {
+                    log_warn ("WTFPr", "template %s contains text after \"%%)\"", Tcl_GetString (filename_obj));
+                }
+
+                int c_len = from - 1 - pos;
+                if (c_len > 0) {
+                    Tcl_AppendToObj (code, txt + pos, c_len);
+                    linenr += ig_tclc_count_nl (txt + pos, c_len);
+                }
+                Tcl_AppendToObj (code, "\n", 1);
+                linenr++;
+
+                block = false;
+                pos   = to + 2;
+            }
+            from = next;
+            continue;
+        }
+
+        /* raw text so far */
+        if (from > pos) {
+            linenr += ig_tclc_wtf_append_raw (code, substmode, txt + pos, from - pos, linenr);
+            Tcl_AppendPrintfToObj (code, "_linenr %d\n", linenr);
+        }
+
+        if ((from + 2 < len) && (txt[from+2] == '(') && ((txt[from+1] == 'I') || (txt[from+1] == 'M'))) {
+            /* include file / subst mode */
+            bool include = (txt[from+1] == 'I');
+
+            Tcl_Obj *cmd = Tcl_DuplicateObj (directive_cmd);
+            Tcl_IncrRefCount (cmd);
+            Tcl_ListObjAppendElement (NULL, cmd, Tcl_NewStringObj (txt + from, to + 1 - from));
+            Tcl_ListObjAppendElement (NULL, cmd, filename_obj);
+            Tcl_ListObjAppendElement (NULL, cmd, Tcl_NewIntObj (linenr));
+            Tcl_ListObjAppendElement (NULL, cmd, filestack);
+            Tcl_ListObjAppendElement (NULL, cmd, substmode);
+            result = Tcl_EvalObjEx (interp, cmd, 0);
+            Tcl_DecrRefCount (cmd);
+            if (result != TCL_OK) goto l_ig_tclc_template_lex_wtf_exit;
+
+            Tcl_Obj  *dir_res = Tcl_GetObjResult (interp);
+            int       dir_len = 0;
+            Tcl_Obj **dir_elems;
+            if ((Tcl_ListObjGetElements (interp, dir_res, &dir_len, &dir_elems) != TCL_OK) || (dir_len != 2)) {
+                result = tcl_error_msg (interp, "directive command has to return code and subst mode");
+                goto l_ig_tclc_template_lex_wtf_exit;
+            }
+
+            if (include) {
+                Tcl_AppendObjToObj (code, dir_elems[0]);
+                Tcl_AppendToObj (code, "\n", 1);
+            }
+            Tcl_DecrRefCount (substmode);
+            substmode = dir_elems[1];
+            Tcl_IncrRefCount (substmode);
+            Tcl_ResetResult (interp);
+
+            /* text/filename objects are kept referenced: string representation stays valid */
+            txt = Tcl_GetStringFromObj (text_obj, &len);
+
+            linenr++;
+            if (include) {
+                ig_tclc_code_append_pos (code, filename_obj, linenr);
+            }
+            pos = to + 2;
+        } else if ((from + 1 < len) && (txt[from+1] == '(')) {
+            /* beginning of block */
+            pos   = from + 2;
+            block = true;
+            linenr++;
+        } else {
+            /* single line */
+            Tcl_AppendToObj (code, txt + from + 1, to - from);
+            Tcl_AppendToObj (code, "\n", 1);
+            pos = to + 2;
+            linenr++;
+        }
+
+        from = next;
+    }
+
+    if (block) {
+        Tcl_SetObjResult (interp, Tcl_NewStringObj ("No matching %)", -1));
+        result = TCL_ERROR;
+        goto l_ig_tclc_template_lex_wtf_exit;
+    }
+
+    if (pos < len) {
+        ig_tclc_wtf_append_raw (code, substmode, txt + pos, len - pos, linenr);
+    }
+
+    Tcl_SetObjResult (interp, code);
+
+l_ig_tclc_template_lex_wtf_exit:
+    Tcl_DecrRefCount (code);
+    Tcl_DecrRefCount (substmode);
+    Tcl_DecrRefCount (filestack);
+    Tcl_DecrRefCount (text_obj);
+    Tcl_DecrRefCount (filename_obj);
+
+    return result;
+}
+
+/* compiled option specification of ig_tclc_parse_opts */
+struct ig_tclc_optspec_entry {
+    Tcl_Obj *regex;       /* private copy of option regex keeping the compiled regexp */
+    Tcl_Obj *helpname;    /* option name for error messages */
+    Tcl_Obj *type;        /* argument type or NULL for constant options */
+    Tcl_Obj *value;       /* value of constant option */
+    Tcl_Obj *var;         /* variable name */
+    bool     type_check;  /* check argument with [string is <type>] */
+    bool     type_list;   /* collect arguments in list */
+};
+
+struct ig_tclc_optspec {
+    int                           refcount;
+    int                           n_entries;
+    struct ig_tclc_optspec_entry *entries;
+    GHashTable                   *matches;  /* key: (char *) argument -> value: (struct ig_tclc_optspec_match *) */
+};
+
+/* cached match result of an argument */
+struct ig_tclc_optspec_match {
+    int entry;      /* index of matching entry or -1 */
+    int match_len;  /* length of match in characters */
+};
+
+/* maximum number of cached argument matches per option specification before the cache is cleared */
+#define IG_TCLC_OPTSPEC_MATCHES_MAX 4096
+
+static void ig_tclc_optspec_free (struct ig_tclc_optspec *spec)
+{
+    if (--spec->refcount > 0) return;
+
+    for (int i = 0; i < spec->n_entries; i++) {
+        struct ig_tclc_optspec_entry *entry = &spec->entries[i];
+
+        Tcl_DecrRefCount (entry->regex);
+        Tcl_DecrRefCount (entry->helpname);
+        Tcl_DecrRefCount (entry->var);
+        if (entry->type  != NULL) Tcl_DecrRefCount (entry->type);
+        if (entry->value != NULL) Tcl_DecrRefCount (entry->value);
+    }
+    g_free (spec->entries);
+    g_hash_table_destroy (spec->matches);
+    g_free (spec);
+}
+
+static void ig_tclc_optspec_free_int_rep (Tcl_Obj *obj)
+{
+    ig_tclc_optspec_free ((struct ig_tclc_optspec *)obj->internalRep.twoPtrValue.ptr1);
+    obj->typePtr = NULL;
+}
+
+static void ig_tclc_optspec_dup_int_rep (Tcl_Obj *src, Tcl_Obj *dup)
+{
+    struct ig_tclc_optspec *spec = (struct ig_tclc_optspec *)src->internalRep.twoPtrValue.ptr1;
+
+    spec->refcount++;
+    dup->internalRep.twoPtrValue.ptr1 = spec;
+    dup->typePtr                      = src->typePtr;
+}
+
+/*
+ * Tcl_Obj type for option specifications of ig::aux::_parse_opts:
+ * the string representation is the specification list and always kept valid,
+ * the internal representation holds the compiled specification (twoPtrValue.ptr1).
+ */
+static const Tcl_ObjType ig_tclc_optspec_type = {
+    "ig_optspec",                 /* name */
+    ig_tclc_optspec_free_int_rep, /* freeIntRepProc */
+    ig_tclc_optspec_dup_int_rep,  /* dupIntRepProc - shares compiled specification */
+    NULL,                         /* updateStringProc - string rep is never invalidated */
+    NULL                          /* setFromAnyProc - see ig_tclc_optspec_get */
+};
+
+/* option name of regex for error messages: regex without leading/trailing "^" and "$" and without "?" */
+static Tcl_Obj *ig_tclc_optspec_helpname (Tcl_Obj *regex)
+{
+    int         len   = 0;
+    const char *str   = Tcl_GetStringFromObj (regex, &len);
+    int         start = 0;
+
+    while ((start < len) && ((str[start] == '^') || (str[start] == '$'))) start++;
+    while ((len > start) && ((str[len-1] == '^') || (str[len-1] == '$'))) len--;
+
+    Tcl_Obj *result = Tcl_NewObj ();
+    for (int i = start; i < len; i++) {
+        if (str[i] != '?') Tcl_AppendToObj (result, str + i, 1);
+    }
+
+    return result;
+}
+
+/* compiled option specification of spec_obj - compiled on first use and cached in spec_obj */
+static struct ig_tclc_optspec *ig_tclc_optspec_get (Tcl_Interp *interp, Tcl_Obj *spec_obj)
+{
+    if (spec_obj->typePtr == &ig_tclc_optspec_type) {
+        return (struct ig_tclc_optspec *)spec_obj->internalRep.twoPtrValue.ptr1;
+    }
+
+    int       n_opts = 0;
+    Tcl_Obj **opts   = NULL;
+
+    if (Tcl_ListObjGetElements (interp, spec_obj, &n_opts, &opts) != TCL_OK) return NULL;
+
+    struct ig_tclc_optspec *spec = g_new0 (struct ig_tclc_optspec, 1);
+
+    spec->refcount  = 1;
+    spec->n_entries = 0;
+    spec->entries   = g_new0 (struct ig_tclc_optspec_entry, n_opts);
+    spec->matches   = g_hash_table_new_full (g_str_hash, g_str_equal, g_free, g_free);
+
+    for (int i = 0; i < n_opts; i++) {
+        int       n_elems = 0;
+        Tcl_Obj **elems   = NULL;
+
+        if (Tcl_ListObjGetElements (interp, opts[i], &n_elems, &elems) != TCL_OK) {
+            ig_tclc_optspec_free (spec);
+            return NULL;
+        }
+
+        struct ig_tclc_optspec_entry *entry = &spec->entries[spec->n_entries++];
+
+        entry->regex    = (n_elems > 0 ? Tcl_DuplicateObj (elems[0]) : Tcl_NewObj ());
+        entry->helpname = ig_tclc_optspec_helpname (entry->regex);
+        entry->var      = (n_elems > 2 ? elems[2] : Tcl_NewObj ());
+        Tcl_IncrRefCount (entry->regex);
+        Tcl_IncrRefCount (entry->helpname);
+        Tcl_IncrRefCount (entry->var);
+
+        /* type: const=<value> or tcl type */
+        const char *type     = (n_elems > 1 ? Tcl_GetString (elems[1]) : "");
+        const char *type_sep = strchr (type, '=');
+        int         type_len = (type_sep != NULL ? type_sep - type : (int)strlen (type));
+
+        if ((type_len == 5) && (strncmp (type, "const", 5) == 0)) {
+            const char *value_end = (type_sep != NULL ? strchr (type_sep + 1, '=') : NULL);
+            if (type_sep == NULL) {
+                entry->value = Tcl_NewObj ();
+            } else if (value_end == NULL) {
+                entry->value = Tcl_NewStringObj (type_sep + 1, -1);
+            } else {
+                entry->value = Tcl_NewStringObj (type_sep + 1, value_end - type_sep - 1);
+            }
+            Tcl_IncrRefCount (entry->value);
+        } else {
+            entry->type = Tcl_NewStringObj (type, type_len);
+            Tcl_IncrRefCount (entry->type);
+            entry->type_list  = (strcmp (Tcl_GetString (entry->type), "list") == 0);
+            entry->type_check = (!entry->type_list && (strcmp (Tcl_GetString (entry->type), "string") != 0));
+        }
+    }
+
+    /* string representation stays valid, list representation is replaced */
+    Tcl_GetString (spec_obj);
+    if ((spec_obj->typePtr != NULL) && (spec_obj->typePtr->freeIntRepProc != NULL)) {
+        spec_obj->typePtr->freeIntRepProc (spec_obj);
+    }
+    spec_obj->internalRep.twoPtrValue.ptr1 = spec;
+    spec_obj->internalRep.twoPtrValue.ptr2 = NULL;
+    spec_obj->typePtr                      = &ig_tclc_optspec_type;
+
+    return spec;
+}
+
+/* match argument against option specification - result is cached in spec */
+static const struct ig_tclc_optspec_match *ig_tclc_optspec_match (Tcl_Interp *interp, struct ig_tclc_optspec *spec, Tcl_Obj *arg)
+{
+    const char                   *arg_str = Tcl_GetString (arg);
+    struct ig_tclc_optspec_match *match   = g_hash_table_lookup (spec->matches, arg_str);
+
+    if (match != NULL) return match;
+
+    int entry     = -1;
+    int match_len = 0;
+
+    for (int i = 0; i < spec->n_entries; i++) {
+        Tcl_RegExp re = Tcl_GetRegExpFromObj (interp, spec->entries[i].regex, TCL_REG_ADVANCED);
+        if (re == NULL) return NULL;
+
+        int result = Tcl_RegExpExecObj (interp, re, arg, 0, 1, 0);
+        if (result < 0) return NULL;
+        if (result == 0) continue;
+
+        Tcl_RegExpInfo info;
+        Tcl_RegExpGetInfo (re, &info);
+
+        entry     = i;
+        match_len = info.matches[0].end - info.matches[0].start;
+        break;
+    }
+
+    if (g_hash_table_size (spec->matches) >= IG_TCLC_OPTSPEC_MATCHES_MAX) {
+        g_hash_table_remove_all (spec->matches);
+    }
+
+    match            = g_new (struct ig_tclc_optspec_match, 1);
+    match->entry     = entry;
+    match->match_len = match_len;
+    g_hash_table_insert (spec->matches, g_strdup (arg_str), match);
+
+    return match;
+}
+
+/* TCLDOC
+##
+# @brief Parse arguments by option specification (internal part of @ref ig::aux::_parse_opts).
+#
+# @param args <b> -spec &lt;optspec&gt; -arguments &lt;arguments&gt;</b><br>
+#    <table style="border:0px; border-spacing:40px 0px;">
+#      <tr><td><b> optspec </b></td><td> option specification as for @ref ig::aux::_parse_opts <br></td></tr>
+#      <tr><td><b> arguments </b></td><td> arguments to parse <br></td></tr>
+#    </table>
+#
+# @return List of arguments without a match, dict of variables to set and
+# help option ("-help", "-helpdoxy" or empty) that stopped parsing.
+#
+# The option specification is compiled on first use and kept in the internal representation of @c optspec,
+# so repeated calls with the same (literal) specification do not need to parse it again.
+# Matches of arguments against the specification are cached as well.
+*/
+static int ig_tclc_parse_opts (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[])
+{
+    Tcl_Obj *spec_obj = NULL;
+    Tcl_Obj *args_obj = NULL;
+
+    Tcl_ArgvInfo arg_table [] = {
+        {TCL_ARGV_FUNC, "-spec",      (void *)(Tcl_ArgvFuncProc *)ig_tclc_tcl_obj_parse, (void *)&spec_obj, "option specification", NULL},
+        {TCL_ARGV_FUNC, "-arguments", (void *)(Tcl_ArgvFuncProc *)ig_tclc_tcl_obj_parse, (void *)&args_obj, "arguments to parse", NULL},
+
+        TCL_ARGV_AUTO_HELP,
+        TCL_ARGV_TABLE_END
+    };
+
+    int result = Tcl_ParseArgsObjv (interp, arg_table, &objc, objv, NULL);
+    if (result != TCL_OK) return result;
+
+    if ((spec_obj == NULL) || (args_obj == NULL)) {
+        return tcl_error_msg (interp, "option specification and arguments must be specified");
+    }
+
+    int       n_args = 0;
+    Tcl_Obj **args   = NULL;
+
+    if (Tcl_ListObjGetElements (interp, args_obj, &n_args, &args) != TCL_OK) return TCL_ERROR;
+
+    struct ig_tclc_optspec *spec = ig_tclc_optspec_get (interp, spec_obj);
+    if (spec == NULL) return TCL_ERROR;
+
+    /* keep specification and arguments while parsing (type checks evaluate tcl code) */
+    spec->refcount++;
+    Tcl_IncrRefCount (args_obj);
+
+    Tcl_Obj    *retval = Tcl_NewListObj (0, NULL);
+    Tcl_Obj    *vars   = Tcl_NewDictObj ();
+    const char *help   = "";
+
+    Tcl_IncrRefCount (retval);
+    Tcl_IncrRefCount (vars);
+
+    for (int i = 0; i < n_args; i++) {
+        Tcl_Obj                            *arg   = args[i];
+        const struct ig_tclc_optspec_match *match = ig_tclc_optspec_match (interp, spec, arg);
+
+        if (match == NULL) {
+            result = TCL_ERROR;
+            goto l_ig_tclc_parse_opts_exit;
+        }
+
+        if (match->entry < 0) {
+            const char *arg_str = Tcl_GetString (arg);
+
+            if ((strcmp (arg_str, "-h") == 0) || (strcmp (arg_str, "-help") == 0)) {
+                help = "-help";
+                break;
+            } else if (strcmp (arg_str, "-helpdoxy") == 0) {
+                help = "-helpdoxy";
+                break;
+            }
+
+            Tcl_ListObjAppendElement (NULL, retval, arg);
+            continue;
+        }
+
+        struct ig_tclc_optspec_entry *entry = &spec->entries[match->entry];
+
+        if (entry->type == NULL) {
+            Tcl_DictObjPut (NULL, vars, entry->var, entry->value);
+            continue;
+        }
+
+        /* option argument: remainder of argument or next argument */
+        Tcl_Obj *value = NULL;
+        if (match->match_len == Tcl_GetCharLength (arg)) {
+            if (i + 1 >= n_args) {
+                Tcl_SetObjResult (interp, Tcl_ObjPrintf ("Option %s expects an argument", Tcl_GetString (entry->helpname)));
+                result = TCL_ERROR;
+                goto l_ig_tclc_parse_opts_exit;
+            }
+            value = args[++i];
+        } else {
+            value = Tcl_GetRange (arg, match->match_len, Tcl_GetCharLength (arg) - 1);
+        }
+        Tcl_IncrRefCount (value);
+
+        if (entry->type_check) {
+            Tcl_Obj *check[4] = {Tcl_NewStringObj ("string", -1), Tcl_NewStringObj ("is", -1), entry->type, value};
+            int      valid    = 0;
+
+            for (int j = 0; j < 4; j++) Tcl_IncrRefCount (check[j]);
+            result = Tcl_EvalObjv (interp, 4, check, 0);
+            if (result == TCL_OK) {
+                result = Tcl_GetBooleanFromObj (interp, Tcl_GetObjResult (interp), &valid);
+            }
+            for (int j = 0; j < 4; j++) Tcl_DecrRefCount (check[j]);
+
+            if ((result == TCL_OK) && !valid) {
+                Tcl_SetObjResult (interp, Tcl_ObjPrintf ("Option %s expects value of type %s but got: %s",
+                            Tcl_GetString (entry->helpname), Tcl_GetString (entry->type), Tcl_GetString (value)));
+                result = TCL_ERROR;
+            }
+            if (result != TCL_OK) {
+                Tcl_DecrRefCount (value);
+                goto l_ig_tclc_parse_opts_exit;
+            }
+        }
+
+        if (entry->type_list) {
+            Tcl_Obj *list = NULL;
+            Tcl_DictObjGet (NULL, vars, entry->var, &list);
+            if (list == NULL) {
+                list = Tcl_NewListObj (0, NULL);
+            } else if (Tcl_IsShared (list)) {
+                list = Tcl_DuplicateObj (list);
+            }
+            Tcl_ListObjAppendElement (NULL, list, value);
+            Tcl_DictObjPut (NULL, vars, entry->var, list);
+        } else {
+            Tcl_DictObjPut (NULL, vars, entry->var, value);
+        }
+        Tcl_DecrRefCount (value);
+    }
+
+    Tcl_Obj *retlist[3] = {retval, vars, Tcl_NewStringObj (help, -1)};
+    Tcl_SetObjResult (interp, Tcl_NewListObj (3, retlist));
+
+l_ig_tclc_parse_opts_exit:
+    Tcl_DecrRefCount (retval);
+    Tcl_DecrRefCount (vars);
+    Tcl_DecrRefCount (args_obj);
+    ig_tclc_optspec_free (spec);
+
+    return result;
+}
+
+/* interval of ig_tclc_interval_overlaps */
+struct ig_tclc_interval {
+    const char  *key;    /* intervals of different keys never overlap */
+    Tcl_WideInt  low;
+    Tcl_WideInt  high;
+    int          index;  /* position in input list = priority (lower index owns overlapping bits) */
+};
+
+/* range owned by a single interval after painting intervals in input order */
+struct ig_tclc_interval_segment {
+    Tcl_WideInt low;
+    Tcl_WideInt high;
+    int         owner;
+};
+
+static int ig_tclc_interval_compare (const void *a, const void *b)
+{
+    const struct ig_tclc_interval *ia = *(const struct ig_tclc_interval * const *)a;
+    const struct ig_tclc_interval *ib = *(const struct ig_tclc_interval * const *)b;
+
+    int result = strcmp (ia->key, ib->key);
+    if (result != 0) return result;
+    if (ia->low != ib->low) return (ia->low > ib->low) - (ia->low < ib->low);
+    return (ia->index > ib->index) - (ia->index < ib->index);
+}
+
+static int ig_tclc_wide_int_compare (const void *a, const void *b)
+{
+    Tcl_WideInt wa = *(const Tcl_WideInt *)a;
+    Tcl_WideInt wb = *(const Tcl_WideInt *)b;
+
+    return (wa > wb) - (wa < wb);
+}
+
+/* min-heap of active intervals ordered by index */
+static void ig_tclc_interval_heap_push (struct ig_tclc_interval **heap, int *size, struct ig_tclc_interval *iv)
+{
+    int i = (*size)++;
+
+    while (i > 0) {
+        int parent = (i - 1) / 2;
+        if (heap[parent]->index <= iv->index) break;
+        heap[i] = heap[parent];
+        i = parent;
+    }
+    heap[i] = iv;
+}
+
+static void ig_tclc_interval_heap_pop (struct ig_tclc_interval **heap, int *size)
+{
+    struct ig_tclc_interval *last = heap[--(*size)];
+    int                      i    = 0;
+
+    while (true) {
+        int child = 2 * i + 1;
+        if (child >= *size) break;
+        if ((child + 1 < *size) && (heap[child+1]->index < heap[child]->index)) child++;
+        if (last->index <= heap[child]->index) break;
+        heap[i] = heap[child];
+        i = child;
+    }
+    if (*size > 0) heap[i] = last;
+}
+
+/*
+ * owner segments of n sorted intervals with the same key:
+ * every point is owned by the interval with the lowest index containing it,
+ * adjacent points of the same owner are merged into one segment
+ */
+static GArray *ig_tclc_interval_segments (struct ig_tclc_interval **ivs, int n)
+{
+    GArray      *segments = g_array_new (false, false, sizeof (struct ig_tclc_interval_segment));
+    Tcl_WideInt *points   = g_new (Tcl_WideInt, 2 * n);
+    int          n_points = 0;
+
+    /* elementary range boundaries */
+    for (int i = 0; i < n; i++) {
+        points[n_points++] = ivs[i]->low;
+        points[n_points++] = ivs[i]->high + 1;
+    }
+    qsort (points, n_points, sizeof (Tcl_WideInt), ig_tclc_wide_int_compare);
+
+    struct ig_tclc_interval **heap      = g_new (struct ig_tclc_interval *, n);
+    int                       heap_size = 0;
+    int                       next      = 0;
+
+    for (int p = 0; p < n_points - 1; p++) {
+        Tcl_WideInt low  = points[p];
+        Tcl_WideInt high = points[p+1] - 1;
+
+        if (high < low) continue;
+
+        while ((next < n) && (ivs[next]->low <= low)) {
+            ig_tclc_interval_heap_push (heap, &heap_size, ivs[next++]);
+        }
+        while ((heap_size > 0) && (heap[0]->high < low)) {
+            ig_tclc_interval_heap_pop (heap, &heap_size);
+        }
+        if (heap_size == 0) continue;
+
+        int owner = heap[0]->index;
+
+        if (segments->len > 0) {
+            struct ig_tclc_interval_segment *last = &g_array_index (segments, struct ig_tclc_interval_segment, segments->len - 1);
+            if ((last->owner == owner) && (last->high + 1 == low)) {
+                last->high = high;
+                continue;
             }
-        } else {
-            // level does not exists:
-            return tcl_error_msg (interp, "Loglevel %s does not exist - try `-help` for a list of available loglevels", loglevel);
         }
+
+        struct ig_tclc_interval_segment seg = {low, high, owner};
+        g_array_append_val (segments, seg);
     }
 
-    return TCL_OK;
+    g_free (heap);
+    g_free (points);
+
+    return segments;
 }
 
 /* TCLDOC
 ##
-# @brief Control log message verbosity.
+# @brief Find overlaps of intervals.
 #
-# @param args <b> [OPTION] LOGMESSAGE</b><br>
+# @param args <b> -intervals &lt;intervals&gt;</b><br>
 #    <table style="border:0px; border-spacing:40px 0px;">
-#      <tr><td><b> LOGMESSAGE </b></td><td> specify the logmessage to be printed </td></tr>
-#      <tr><td><b> OPTION </b></td><td><br></td></tr>
-#      <tr><td><i> &ensp; &ensp; -id      </i></td><td>  specify the logid                 <br></td></tr>
-#      <tr><td><i> &ensp; &ensp; -debug   </i></td><td>  specify debug as max. loglevel    <br></td></tr>
-#      <tr><td><i> &ensp; &ensp; -info    </i></td><td>  specify info as max. loglevel     <br></td></tr>
-#      <tr><td><i> &ensp; &ensp; -warning </i></td><td>  specify warning as max. loglevel  <br></td></tr>
-#      <tr><td><i> &ensp; &ensp; -error   </i></td><td>  specify error as max. loglevel    <br></td></tr>
-#      <tr><td><i> &ensp; &ensp; -abort   </i></td><td>  throw TCL_ERROR                   <br></td></tr>
+#      <tr><td><b> intervals </b></td><td> list of intervals of form {key low high} <br></td></tr>
 #    </table>
 #
+# @return List with an element for each interval: flat list of overlaps {owner low high ...}.
+#
+# Intervals are processed in list order: each point belongs to the first interval containing it (the owner),
+# so the overlaps of an interval are the ranges already owned by intervals earlier in the list,
+# with owner being the list index of that interval.
+# Only intervals of the same key can overlap, empty intervals (high &lt; low) are ignored.
+# Overlaps are found on sorted intervals in O(n log n) plus the number of reported overlaps.
 */
-static int ig_tclc_log (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[])
+static int ig_tclc_interval_overlaps (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[])
 {
-    char *log_id   = "Tcl";
-    gint  loglevel = LOGLEVEL_INFO;
-    gint  abort    = 0;
+    Tcl_Obj *intervals_obj = NULL;
 
     Tcl_ArgvInfo arg_table [] = {
-        {TCL_ARGV_STRING,   "-id",      NULL,                               (void *)&log_id,       "log id",                              NULL},
-        {TCL_ARGV_CONSTANT, "-debug",   GINT_TO_POINTER (LOGLEVEL_DEBUG),   (void *)&loglevel,     "loglevel debug",                      NULL},
-        {TCL_ARGV_CONSTANT, "-info",    GINT_TO_POINTER (LOGLEVEL_INFO),    (void *)&loglevel,     "loglevel info",                       NULL},
-        {TCL_ARGV_CONSTANT, "-warning", GINT_TO_POINTER (LOGLEVEL_WARNING), (void *)&loglevel,     "loglevel warning",                    NULL},
-        {TCL_ARGV_CONSTANT, "-error",   GINT_TO_POINTER (LOGLEVEL_ERROR),   (void *)&loglevel,     "loglevel error",                      NULL},
-        {TCL_ARGV_CONSTANT, "-abort",   GINT_TO_POINTER (1),                (void *)&abort,        "return the log message as tcl error", NULL},
+        {TCL_ARGV_FUNC, "-intervals", (void *)(Tcl_ArgvFuncProc *)ig_tclc_tcl_obj_parse, (void *)&intervals_obj, "list of intervals {key low high}", NULL},
 
         TCL_ARGV_AUTO_HELP,
         TCL_ARGV_TABLE_END
     };
 
-    Tcl_Obj **remObjv = NULL;
-    int       result  = Tcl_ParseArgsObjv (interp, arg_table, &objc, objv, &remObjv);
+    int result = Tcl_ParseArgsObjv (interp, arg_table, &objc, objv, NULL);
+    if (result != TCL_OK) return result;
 
-    if (result != TCL_OK) {
-        if (objc != 0) ckfree (remObjv);
-        return result;
+    if (intervals_obj == NULL) return tcl_error_msg (interp, "No intervals specified");
+
+    Tcl_IncrRefCount (intervals_obj);
+
+    int       n_ivs    = 0;
+    Tcl_Obj **iv_objs  = NULL;
+
+    struct ig_tclc_interval  *ivs     = NULL;
+    struct ig_tclc_interval **sorted  = NULL;
+    int                       n_valid = 0;
+    Tcl_Obj                 **results = NULL;
+
+    if (Tcl_ListObjGetElements (interp, intervals_obj, &n_ivs, &iv_objs) != TCL_OK) {
+        result = TCL_ERROR;
+        goto l_ig_tclc_interval_overlaps_exit;
     }
 
-    char *msg = "";
+    ivs     = g_new (struct ig_tclc_interval, n_ivs);
+    sorted  = g_new (struct ig_tclc_interval *, n_ivs);
+    results = g_new0 (Tcl_Obj *, n_ivs);
 
-    if (objc > 0) {
-        for (int i = 1; i < objc; i++) {
-            msg = Tcl_GetString (remObjv[i]);
-            char *file       = "TCL-Unknown";
-            char *cmd        = NULL;
-            int   linenumber = 0;
+    for (int i = 0; i < n_ivs; i++) {
+        int       n_elems = 0;
+        Tcl_Obj **elems   = NULL;
 
-            if (!log_suppress (loglevel, log_id)) {
-                if (Tcl_Eval (interp, "info frame -1") == TCL_OK) {
-                    Tcl_Obj *dict_info_frame = Tcl_GetObjResult (interp);
+        if (Tcl_ListObjGetElements (interp, iv_objs[i], &n_elems, &elems) != TCL_OK) {
+            result = TCL_ERROR;
+            goto l_ig_tclc_interval_overlaps_exit;
+        }
+        if (n_elems != 3) {
+            result = tcl_error_msg (interp, "Invalid interval \"%s\" - expected {key low high}", Tcl_GetString (iv_objs[i]));
+            goto l_ig_tclc_interval_overlaps_exit;
+        }
 
-                    if (!tcl_dict_get_str (interp, dict_info_frame, "file", &file)) {
-                        if (tcl_dict_get_str (interp, dict_info_frame, "cmd", &cmd)) {
-                            cmd  = g_strdup_printf ("TCL-CMD(%s)", cmd);
-                            file = cmd;
-                        } else if (tcl_dict_get_str (interp, dict_info_frame, "proc", &cmd)) {
-                            cmd  = g_strdup_printf ("TCL-PROC(%s)", cmd);
-                            file = cmd;
-                        }
-                    }
+        struct ig_tclc_interval *iv = &ivs[i];
 
-                    if (get_loglinenumbers ()) {
-                        tcl_dict_get_int (interp, dict_info_frame, "line", &linenumber);
-                    }
+        iv->key   = Tcl_GetString (elems[0]);
+        iv->index = i;
+        if ((Tcl_GetWideIntFromObj (interp, elems[1], &iv->low) != TCL_OK)
+            || (Tcl_GetWideIntFromObj (interp, elems[2], &iv->high) != TCL_OK)) {
+            result = TCL_ERROR;
+            goto l_ig_tclc_interval_overlaps_exit;
+        }
+
+        if (iv->high >= iv->low) sorted[n_valid++] = iv;
+    }
+
+    qsort (sorted, n_valid, sizeof (struct ig_tclc_interval *), ig_tclc_interval_compare);
+
+    /* process groups of intervals with the same key */
+    for (int group = 0; group < n_valid;) {
+        int group_end = group + 1;
+        while ((group_end < n_valid) && (strcmp (sorted[group]->key, sorted[group_end]->key) == 0)) group_end++;
+
+        GArray *segments = ig_tclc_interval_segments (&sorted[group], group_end - group);
+
+        for (int i = group; i < group_end; i++) {
+            struct ig_tclc_interval *iv = sorted[i];
+
+            /* first segment not below interval */
+            unsigned int s_low  = 0;
+            unsigned int s_high = segments->len;
+            while (s_low < s_high) {
+                unsigned int s_mid = (s_low + s_high) / 2;
+                if (g_array_index (segments, struct ig_tclc_interval_segment, s_mid).high < iv->low) {
+                    s_low = s_mid + 1;
+                } else {
+                    s_high = s_mid;
                 }
             }
 
-            log_base (loglevel, log_id, basename (file), linenumber, "%s", msg);
-            g_free (cmd);
+            for (unsigned int s = s_low; s < segments->len; s++) {
+                struct ig_tclc_interval_segment *seg = &g_array_index (segments, struct ig_tclc_interval_segment, s);
+
+                if (seg->low > iv->high) break;
+                if (seg->owner == iv->index) continue;
+
+                if (results[iv->index] == NULL) {
+                    results[iv->index] = Tcl_NewListObj (0, NULL);
+                    Tcl_IncrRefCount (results[iv->index]);
+                }
+                Tcl_ListObjAppendElement (interp, results[iv->index], Tcl_NewIntObj (seg->owner));
+                Tcl_ListObjAppendElement (interp, results[iv->index], Tcl_NewWideIntObj (MAX (seg->low,  iv->low)));
+                Tcl_ListObjAppendElement (interp, results[iv->index], Tcl_NewWideIntObj (MIN (seg->high, iv->high)));
+            }
         }
+
+        g_array_free (segments, true);
+        group = group_end;
     }
 
-    if (abort) {
-        Tcl_SetObjResult (interp, Tcl_NewStringObj (msg, -1));
+    Tcl_Obj *retval = Tcl_NewListObj (0, NULL);
+    Tcl_Obj *empty  = Tcl_NewObj ();
+
+    for (int i = 0; i < n_ivs; i++) {
+        Tcl_ListObjAppendElement (interp, retval, (results[i] != NULL ? results[i] : empty));
     }
+    Tcl_SetObjResult (interp, retval);
 
-    if (objc != 0) ckfree (remObjv);
+l_ig_tclc_interval_overlaps_exit:
+    if (results != NULL) {
+        for (int i = 0; i < n_ivs; i++) {
+            if (results[i] != NULL) Tcl_DecrRefCount (results[i]);
+        }
+    }
+    g_free (results);
+    g_free (sorted);
+    g_free (ivs);
+    Tcl_DecrRefCount (intervals_obj);
 
-    if (abort) return TCL_ERROR;
-    return TCL_OK;
+    return result;
+}
+
+/* byte length of utf-8 character at text if it is a word character (alnum or underscore), 0 otherwise */
+static int ig_tclc_word_char_len (const char *text)
+{
+    unsigned char c = (unsigned char)text[0];
+
+    if (c < 0x80) {
+        return ((((c >= 'a') && (c <= 'z')) || ((c >= 'A') && (c <= 'Z')) || ((c >= '0') && (c <= '9')) || (c == '_')) ? 1 : 0);
+    }
+
+    Tcl_UniChar uc  = 0;
+    int         len = Tcl_UtfToUniChar (text, &uc);
+
+    return (Tcl_UniCharIsAlnum (uc) ? len : 0);
 }
 
 /* TCLDOC
 ##
-# @brief Control log message verbosity.
+# @brief Replace identifiers in code (internal part of @ref ig::aux::adapt_codesection_replace).
 #
-# @param args <b> [OPTION]</b><br>
+# @param args <b> -code &lt;code&gt; -map &lt;replace_map&gt; ?-selective?</b><br>
 #    <table style="border:0px; border-spacing:40px 0px;">
-#      <tr><td><b> OPTION </b></td><td><br></td></tr>
-#      <tr><td><i> &ensp; &ensp; -level  </i></td><td>  specify the loglevel  <br></td></tr>
-#      <tr><td><i> &ensp; &ensp; -suppress  </i></td><td>  get number of suppressed log messages  <br></td></tr>
+#      <tr><td><b> code </b></td><td> code to adapt <br></td></tr>
+#      <tr><td><b> replace_map </b></td><td> dict mapping identifiers to their replacements <br></td></tr>
+#      <tr><td><b> selective </b></td><td> only replace identifiers marked by a trailing "!" <br></td></tr>
 #    </table>
 #
+# @return List of adapted code and list of marked identifiers not found in @c replace_map.
+#
+# Identifiers are maximal sequences of alphanumeric characters and underscores.
+# In selective mode the "!" marker is removed, also for identifiers not found in @c replace_map.
 */
-static int ig_tclc_log_stat (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[])
+static int ig_tclc_adapt_code (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[])
 {
-    char *loglevel = NULL;
-    gint  suppress = 0;
+    Tcl_Obj *code_obj  = NULL;
+    Tcl_Obj *map_obj   = NULL;
+    int      selective = 0;
 
     Tcl_ArgvInfo arg_table [] = {
-        {TCL_ARGV_STRING,   "-level",    NULL,                (void *)&loglevel, "log level",                                    NULL},
-        {TCL_ARGV_CONSTANT, "-suppress", GINT_TO_POINTER (1), (void *)&suppress, "return the log message as tcl error", NULL},
+        {TCL_ARGV_FUNC,     "-code",      (void *)(Tcl_ArgvFuncProc *)ig_tclc_tcl_obj_parse, (void *)&code_obj,  "code to adapt", NULL},
+        {TCL_ARGV_FUNC,     "-map",       (void *)(Tcl_ArgvFuncProc *)ig_tclc_tcl_obj_parse, (void *)&map_obj,   "replacement dict", NULL},
+        {TCL_ARGV_CONSTANT, "-selective", GINT_TO_POINTER (1),                              (void *)&selective, "only replace identifiers marked by \"!\"", NULL},
 
         TCL_ARGV_AUTO_HELP,
         TCL_ARGV_TABLE_END
     };
 
     int result = Tcl_ParseArgsObjv (interp, arg_table, &objc, objv, NULL);
-
     if (result != TCL_OK) {
         return result;
     }
 
-    Tcl_Obj *retval = NULL;
+    if ((code_obj == NULL) || (map_obj == NULL)) {
+        return tcl_error_msg (interp, "code and replacement map must be specified");
+    }
 
-    if (loglevel == NULL) {
-        retval = Tcl_NewListObj (0, NULL);
-        for (int i = 0; i < LOGLEVEL_COUNT; i++) {
-            Tcl_ListObjAppendElement (interp, retval, Tcl_NewStringObj (loglevel_label[i], -1));
-            Tcl_Obj *log_count = Tcl_NewIntObj (suppress ? get_log_count_suppressed (i) : get_log_count_print (i));
-            Tcl_ListObjAppendElement (interp, retval, log_count);
+    int         len        = 0;
+    const char *code       = Tcl_GetStringFromObj (code_obj, &len);
+    Tcl_Obj    *code_out   = Tcl_NewObj ();
+    Tcl_Obj    *unresolved = Tcl_NewListObj (0, NULL);
+    int         pos        = 0;
+    int         copied     = 0;
+
+    Tcl_IncrRefCount (code_out);
+    Tcl_IncrRefCount (unresolved);
+    Tcl_IncrRefCount (code_obj);
+    Tcl_IncrRefCount (map_obj);
+
+    while (pos < len) {
+        int clen = ig_tclc_word_char_len (code + pos);
+        if (clen == 0) {
+            pos += Tcl_UtfNext (code + pos) - (code + pos);
+            continue;
         }
-    } else if (loglevel != NULL) {
-        gboolean found_level = false;
-        int      i           = 0;
-        for (i = 0; i < LOGLEVEL_COUNT; i++) {
-            if (g_strcmp0 (loglevel, loglevel_label[i]) == 0) {
-                found_level = true;
-                break;
-            }
+
+        int start = pos;
+        do {
+            pos += clen;
+        } while ((pos < len) && ((clen = ig_tclc_word_char_len (code + pos)) > 0));
+
+        if (selective) {
+            if ((pos >= len) || (code[pos] != '!')) continue;
         }
-        if (found_level) {
-            retval = Tcl_NewIntObj (suppress ? get_log_count_suppressed (i) : get_log_count_print (i));
+
+        Tcl_Obj *name        = Tcl_NewStringObj (code + start, pos - start);
+        Tcl_Obj *replacement = NULL;
+
+        Tcl_IncrRefCount (name);
+        if (Tcl_DictObjGet (interp, map_obj, name, &replacement) != TCL_OK) {
+            Tcl_DecrRefCount (name);
+            result = TCL_ERROR;
+            goto l_ig_tclc_adapt_code_exit;
+        }
+
+        Tcl_AppendToObj (code_out, code + copied, start - copied);
+        if (replacement != NULL) {
+            Tcl_AppendObjToObj (code_out, replacement);
         } else {
-            // level does not exists:
-            return tcl_error_msg (interp, "Loglevel %s does not exist - try `-help` for a list of available loglevels", loglevel);
+            Tcl_AppendObjToObj (code_out, name);
+            if (selective) {
+                Tcl_ListObjAppendElement (NULL, unresolved, name);
+            }
         }
+        Tcl_DecrRefCount (name);
+
+        if (selective) pos++;
+        copied = pos;
     }
 
-    Tcl_SetObjResult (interp, retval);
+    Tcl_AppendToObj (code_out, code + copied, len - copied);
+
+    Tcl_Obj *retval[2] = {code_out, unresolved};
+    Tcl_SetObjResult (interp, Tcl_NewListObj (2, retval));
+
+l_ig_tclc_adapt_code_exit:
+    Tcl_DecrRefCount (code_out);
+    Tcl_DecrRefCount (unresolved);
+    Tcl_DecrRefCount (code_obj);
+    Tcl_DecrRefCount (map_obj);
+
+    return result;
+}
+
+/* TCLDOC
+##
+# @brief Fork the current process.
+#
+# @return process id of the child in the parent process, 0 in the child process.
+#
+# The child process continues with a copy of the interpreter and database,
+# e.g. for generating output in parallel worker processes.
+# Pending output of stdout/stderr channels is flushed before forking.
+*/
+static int ig_tclc_fork (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[])
+{
+    if (objc != 1) {
+        Tcl_WrongNumArgs (interp, 1, objv, NULL);
+        return TCL_ERROR;
+    }
+
+    const char *chan_names[] = {"stdout", "stderr"};
+    for (size_t i = 0; i < sizeof (chan_names) / sizeof (chan_names[0]); i++) {
+        Tcl_Channel chan = Tcl_GetChannel (interp, chan_names[i], NULL);
+        if (chan != NULL) {
+            Tcl_Flush (chan);
+        }
+    }
+    Tcl_ResetResult (interp);
+    fflush (stdout);
+    fflush (stderr);
+
+    pid_t pid = fork ();
+    if (pid < 0) {
+        return tcl_error_msg (interp, "fork failed: %s", strerror (errno));
+    }
+
+    Tcl_SetObjResult (interp, Tcl_NewIntObj (pid));
     return TCL_OK;
 }
 
 /* TCLDOC
 ##
-# @brief print the icglue logo
+# @brief Wait for a child process to terminate.
+#
+# @param args <b> -pid &lt;pid&gt;</b><br>
+#    <table style="border:0px; border-spacing:40px 0px;">
+#      <tr><td><b> pid </b></td><td> process id of child created by @ref ig::sys::fork <br></td></tr>
+#    </table>
 #
+# @return exit code of the child process or -1 if it did not terminate normally.
 */
-static int ig_tclc_print_logo (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[])
+static int ig_tclc_waitpid (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[])
 {
-    ig_print_logo (stderr);
+    int pid = -1;
+
+    Tcl_ArgvInfo arg_table [] = {
+        {TCL_ARGV_INT, "-pid", NULL, (void *)&pid, "process id", NULL},
+
+        TCL_ARGV_AUTO_HELP,
+        TCL_ARGV_TABLE_END
+    };
+
+    int result = Tcl_ParseArgsObjv (interp, arg_table, &objc, objv, NULL);
+    if (result != TCL_OK) {
+        return result;
+    }
+
+    if (pid <= 0) {
+        return tcl_error_msg (interp, "no valid process id specified");
+    }
+
+    int   status;
+    pid_t wres;
+    do {
+        wres = waitpid (pid, &status, 0);
+    } while ((wres < 0) && (errno == EINTR));
+
+    if (wres < 0) {
+        return tcl_error_msg (interp, "waiting for process %d failed: %s", pid, strerror (errno));
+    }
+
+    Tcl_SetObjResult (interp, Tcl_NewIntObj (WIFEXITED (status) ? WEXITSTATUS (status) : -1));
+    return TCL_OK;
+}
+
+/* TCLDOC
+##
+# @brief Redirect stderr of the current process (and thereby log output) to a file.
+#
+# @param args <b> -file &lt;filename&gt;</b><br>
+#    <table style="border:0px; border-spacing:40px 0px;">
+#      <tr><td><b> filename </b></td><td> file to write stderr output to (truncated) <br></td></tr>
+#    </table>
+#
+# Intended for worker processes created by @ref ig::sys::fork to collect their log output.
+*/
+static int ig_tclc_redirect_stderr (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[])
+{
+    char *filename = NULL;
+
+    Tcl_ArgvInfo arg_table [] = {
+        {TCL_ARGV_STRING, "-file", NULL, (void *)&filename, "output file", NULL},
+
+        TCL_ARGV_AUTO_HELP,
+        TCL_ARGV_TABLE_END
+    };
+
+    int result = Tcl_ParseArgsObjv (interp, arg_table, &objc, objv, NULL);
+    if (result != TCL_OK) {
+        return result;
+    }
+
+    if (filename == NULL) {
+        return tcl_error_msg (interp, "no file specified");
+    }
+
+    Tcl_Channel chan = Tcl_GetChannel (interp, "stderr", NULL);
+    if (chan != NULL) {
+        Tcl_Flush (chan);
+    }
+    Tcl_ResetResult (interp);
+    fflush (stderr);
+
+    int fd = open (filename, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        return tcl_error_msg (interp, "unable to open %s: %s", filename, strerror (errno));
+    }
+    if (dup2 (fd, STDERR_FILENO) < 0) {
+        int err = errno;
+        close (fd);
+        return tcl_error_msg (interp, "unable to redirect stderr to %s: %s", filename, strerror (err));
+    }
+    close (fd);
+
+    return TCL_OK;
+}
+
+/* TCLDOC
+##
+# @brief Create a unique temporary directory.
+#
+# @param args <b> -prefix &lt;prefix&gt;</b><br>
+#    <table style="border:0px; border-spacing:40px 0px;">
+#      <tr><td><b> prefix </b></td><td> path prefix of the directory, a random suffix is appended <br></td></tr>
+#    </table>
+#
+# @return path of the created directory.
+#
+# The directory is created with mode 0700 and fails if the path already exists (see mkdtemp(3)),
+# so its name cannot be predicted or taken over by other users.
+*/
+static int ig_tclc_mkdtemp (ClientData clientdata, Tcl_Interp *interp, int objc, Tcl_Obj *const objv[])
+{
+    char *prefix = NULL;
+
+    Tcl_ArgvInfo arg_table [] = {
+        {TCL_ARGV_STRING, "-prefix", NULL, (void *)&prefix, "path prefix", NULL},
+
+        TCL_ARGV_AUTO_HELP,
+        TCL_ARGV_TABLE_END
+    };
+
+    int result = Tcl_ParseArgsObjv (interp, arg_table, &objc, objv, NULL);
+    if (result != TCL_OK) {
+        return result;
+    }
+
+    if (prefix == NULL) {
+        return tcl_error_msg (interp, "no prefix specified");
+    }
+
+    char *path = g_strdup_printf ("%sXXXXXX", prefix);
+    if (mkdtemp (path) == NULL) {
+        result = tcl_error_msg (interp, "unable to create temporary directory %s: %s", path, strerror (errno));
+        g_free (path);
+        return result;
+    }
+
+    Tcl_SetObjResult (interp, Tcl_NewStringObj (path, -1));
+    g_free (path);
+
     return TCL_OK;
 }
+
 static int tcl_error_msg (Tcl_Interp *interp, const char *format, ...)
 {
     int     result;
@@ -28,6 +28,10 @@ static gboolean    log_linenumbers   = FALSE;
 static log_level_t default_log_level = LOGLEVEL_INFO;
 static GHashTable *log_property      = NULL;
 
+/* range of configured log levels: below min everything is suppressed, from max on nothing */
+static log_level_t log_level_min = LOGLEVEL_INFO;
+static log_level_t log_level_max = LOGLEVEL_INFO;
+
 static guint log_count_print[LOGLEVEL_COUNT];
 static guint log_count_suppressed[LOGLEVEL_COUNT];
 
@@ -57,10 +61,41 @@ guint get_log_count_suppressed (log_level_t log_level)
     }
 }
 
+void log_count_add (log_level_t log_level, guint count, gboolean suppressed)
+{
+    if ((log_level > -1) && (log_level < LOGLEVEL_COUNT)) {
+        if (suppressed) {
+            log_count_suppressed[log_level] += count;
+        } else {
+            log_count_print[log_level] += count;
+        }
+    }
+}
+
+
+/* update range of configured log levels */
+static void log_level_range_update (void)
+{
+    log_level_min = default_log_level;
+    log_level_max = default_log_level;
+
+    if (log_property == NULL) return;
+
+    GHashTableIter iter;
+    gpointer       id_local, level;
+
+    g_hash_table_iter_init (&iter, log_property);
+    while (g_hash_table_iter_next (&iter, &id_local, &level)) {
+        log_level_t i_level = GPOINTER_TO_INT (level);
+        if (i_level < log_level_min) log_level_min = i_level;
+        if (i_level > log_level_max) log_level_max = i_level;
+    }
+}
 
 void set_default_log_level (log_level_t log_level)
 {
     default_log_level = log_level;
+    log_level_range_update ();
 }
 
 void set_loglinenumbers (gboolean value)
@@ -88,6 +123,7 @@ void log_particular_level (const gchar *id, const log_level_t level)
     gchar *id_local = g_string_chunk_insert_const (ids, id);
 
     g_hash_table_insert (log_property, id_local, GINT_TO_POINTER (level));
+    log_level_range_update ();
 }
 
 void log_base (const log_level_t level, const gchar *id, const gchar *sfile, gint sline, const gchar *format, ...)
@@ -110,6 +146,19 @@ gboolean log_suppress (const log_level_t level, const gchar *id)
     return (level < log_level_threshold);
 }
 
+gboolean log_enabled (const log_level_t level, const gchar *id)
+{
+    if (level < log_level_min) return FALSE;
+    if (level >= log_level_max) return TRUE;
+
+    return !log_suppress (level, id);
+}
+
+void log_count_suppress (const log_level_t level)
+{
+    log_count_suppressed[level]++;
+}
+
 // adapted from libappstream-glib
 guint string_replace (GString *string, const gchar *search, const gchar *replace)
 {
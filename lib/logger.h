@@ -56,13 +56,30 @@ typedef enum log_level {
  */
 extern gchar *loglevel_label[LOGLEVEL_COUNT];
 
+/**
+ * @brief Printf-like logging with given level.
+ * @param level Loglevel to use.
+ * @param id Identifier for log messages. Is printed next to message and can be used for selective enabling/disabling.
+ * @param format Printf-like format string.
+ * @param ... Optional printf-like variadic arguments.
+ *
+ * Arguments are only evaluated and formatted if the message is not suppressed (see @ref log_enabled).
+ */
+#define log_level_msg(level, id, format, ...) do { \
+        if (log_enabled (level, id)) { \
+            log_base (level, id, __FILE__, __LINE__, format, ## __VA_ARGS__); \
+        } else { \
+            log_count_suppress (level); \
+        } \
+} while (0)
+
 /**
  * @brief Printf-like debug logging.
  * @param id Identifier for log messages. Is printed next to message and can be used for selective enabling/disabling.
  * @param format Printf-like format string.
  * @param ... Optional printf-like variadic arguments.
  */
-#define log_debug(id, format, ...)    log_base (LOGLEVEL_DEBUG, id, __FILE__, __LINE__, format, ## __VA_ARGS__)
+#define log_debug(id, format, ...)    log_level_msg (LOGLEVEL_DEBUG, id, format, ## __VA_ARGS__)
 
 /**
  * @brief Printf-like informational logging.
@@ -70,7 +87,7 @@ extern gchar *loglevel_label[LOGLEVEL_COUNT];
  * @param format Printf-like format string.
  * @param ... Optional printf-like variadic arguments.
  */
-#define log_info(id, format, ...)     log_base (LOGLEVEL_INFO, id, __FILE__, __LINE__, format, ## __VA_ARGS__)
+#define log_info(id, format, ...)     log_level_msg (LOGLEVEL_INFO, id, format, ## __VA_ARGS__)
 
 /**
  * @brief Printf-like warning-message logging.
@@ -78,7 +95,7 @@ extern gchar *loglevel_label[LOGLEVEL_COUNT];
  * @param format Printf-like format string.
  * @param ... Optional printf-like variadic arguments.
  */
-#define log_warn(id, format, ...)     log_base (LOGLEVEL_WARNING, id, __FILE__, __LINE__, format, ## __VA_ARGS__)
+#define log_warn(id, format, ...)     log_level_msg (LOGLEVEL_WARNING, id, format, ## __VA_ARGS__)
 
 /**
  * @brief Printf-like error-message logging.
@@ -86,7 +103,7 @@ extern gchar *loglevel_label[LOGLEVEL_COUNT];
  * @param format Printf-like format string.
  * @param ... Optional printf-like variadic arguments.
  */
-#define log_error(id, format, ...)    log_base (LOGLEVEL_ERROR, id, __FILE__, __LINE__, format, ## __VA_ARGS__)
+#define log_error(id, format, ...)    log_level_msg (LOGLEVEL_ERROR, id, format, ## __VA_ARGS__)
 
 /**
  * @brief Printf-like error-message logging for library internal errors.
@@ -96,7 +113,7 @@ extern gchar *loglevel_label[LOGLEVEL_COUNT];
  *
  * Logging an internal error will call exit(1) afterwards.
  */
-#define log_errorint(id, format, ...) log_base (LOGLEVEL_ERRORINT, id, __FILE__, __LINE__, format, ## __VA_ARGS__);
+#define log_errorint(id, format, ...) log_level_msg (LOGLEVEL_ERRORINT, id, format, ## __VA_ARGS__);
 
 /**
  * @brief Basic log function.
@@ -156,6 +173,23 @@ void log_particular_level (const gchar *id, const log_level_t level);
  */
 gboolean log_suppress (const log_level_t level, const gchar *id);
 
+/**
+ * @brief Check whether log output is enabled for specific level/identifier.
+ * @param level Log level of message to check.
+ * @param id Identifier of message to check.
+ * @return @c true if message is to be printed, @c false if message is to be suppressed.
+ *
+ * Levels below all configured levels are rejected without identifier lookup.
+ * Can be used to skip expensive preparation of log output.
+ */
+gboolean log_enabled (const log_level_t level, const gchar *id);
+
+/**
+ * @brief Count a suppressed log message that was skipped by @ref log_enabled.
+ * @param level Log level of message.
+ */
+void log_count_suppress (const log_level_t level);
+
 /**
  * @brief Print current log level settings to stderr.
  */
@@ -171,6 +205,16 @@ guint get_log_count_print (log_level_t log_level);
  */
 guint get_log_count_suppressed (log_level_t log_level);
 
+/**
+ * @brief Add to log message statistics.
+ * @param log_level Log level of messages.
+ * @param count Number of messages to add.
+ * @param suppressed @c true adds to suppressed messages, @c false to printed messages.
+ *
+ * Used to merge statistics of log messages generated in other processes.
+ */
+void log_count_add (log_level_t log_level, guint count, gboolean suppressed);
+
 #ifdef __cplusplus
 }
 #endif
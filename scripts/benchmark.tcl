@@ -0,0 +1,550 @@
+#!/usr/bin/env tclsh
+
+#
+#   ICGlue is a Tcl-Library for scripted HDL generation
+#   Copyright (C) 2017-2020  Andreas Dixius, Felix Neumärker
+#
+#   This program is free software: you can redistribute it and/or modify
+#   it under the terms of the GNU General Public License as published by
+#   the Free Software Foundation, either version 3 of the License, or
+#   (at your option) any later version.
+#
+#   This program is distributed in the hope that it will be useful,
+#   but WITHOUT ANY WARRANTY; without even the implied warranty of
+#   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#   GNU General Public License for more details.
+#
+#   You should have received a copy of the GNU General Public License
+#   along with this program.  If not, see <https://www.gnu.org/licenses/>.
+#
+
+# usage: benchmark.tcl [-scale <factor>] [<case> ...]
+#   runs all benchmark cases (or the ones given) and prints runtime/memory statistics.
+
+# set package path and load ICGlue package
+lappend auto_path [file normalize [file join [file dirname [file dirname [file normalize $::argv0]]] lib]]
+set icglue_silent_load "true"
+package require ICGlue 5.0a1
+
+namespace eval bench {
+    variable cases [list]
+    variable scale 1
+
+    ## @brief Register a benchmark case.
+    # @param name Name of case.
+    # @param description Short description printed with results.
+    # @param body Script to run - result is a list of label/value pairs.
+    proc case {name description body} {
+        variable cases
+        lappend cases $name $description
+        proc case_${name} {} $body
+    }
+
+    ## @brief Scale a problem size by the -scale factor.
+    proc scaled {n} {
+        variable scale
+        return [expr {max (1, int ($n * $scale))}]
+    }
+
+    ## @brief Resident set size of current process in kiB (0 if unavailable).
+    proc rss_kib {} {
+        if {[catch {open "/proc/self/status" "r"} f]} {
+            return 0
+        }
+        set result 0
+        foreach line [split [read $f] "\n"] {
+            if {[regexp {^VmRSS:\s+(\d+)\s+kB} $line -> result]} {
+                break
+            }
+        }
+        close $f
+        return $result
+    }
+
+    ## @brief Run script and return runtime in ms.
+    proc time_ms {script} {
+        set t [lindex [uplevel 1 [list time $script 1]] 0]
+        return [format "%.1f" [expr {$t / 1000.0}]]
+    }
+
+    ## @brief Number of objects currently in database.
+    proc object_count {} {
+        set result 0
+        foreach m [ig::db::get_modules -all] {
+            incr result
+            foreach cmd {get_ports get_declarations get_parameters get_codesections} {
+                incr result [llength [ig::db::$cmd -of $m -all]]
+            }
+        }
+        foreach i [ig::db::get_instances -all] {
+            incr result
+            foreach cmd {get_pins get_adjustments} {
+                incr result [llength [ig::db::$cmd -of $i -all]]
+            }
+        }
+        incr result [llength [ig::db::get_nets -all]]
+        incr result [llength [ig::db::get_generics -all]]
+        return $result
+    }
+
+    ## @brief Generate a hierarchy of modules with connected signals.
+    # @param n_modules Number of submodules instantiated in the top module.
+    # @param n_signals Number of signals between neighbouring submodules.
+    proc gen_hierarchy {n_modules n_signals} {
+        set top [ig::db::create_module -name "bench_top"]
+        ig::db::set_attribute -object $top -attributes {"language" "verilog" "mode" "rtl" "parentunit" "bench"}
+
+        set insts [list]
+        for {set i 0} {$i < $n_modules} {incr i} {
+            set mod [ig::db::create_module -name "bench_sub${i}"]
+            ig::db::set_attribute -object $mod -attributes {"language" "verilog" "mode" "rtl" "parentunit" "bench"}
+            lappend insts [ig::db::create_instance -name "bench_sub${i}" -of-module $mod -parent-module $top]
+        }
+
+        for {set i 0} {$i < $n_modules} {incr i} {
+            set src [lindex $insts $i]
+            set dst [lindex $insts [expr {($i + 1) % $n_modules}]]
+            for {set s 0} {$s < $n_signals} {incr s} {
+                ig::db::connect -from $src -to [list $dst] -signal-name "sig${i}_${s}" -signal-size 8
+            }
+        }
+    }
+}
+
+#-------------------------------------------------------
+# benchmark cases
+
+bench::case "attr-memory" "memory footprint of a generated hierarchy" {
+    set n_modules [bench::scaled 200]
+    set n_signals 20
+
+    set rss_before [bench::rss_kib]
+    set t_gen      [bench::time_ms {bench::gen_hierarchy $n_modules $n_signals}]
+    set rss_after  [bench::rss_kib]
+    set n_objs     [bench::object_count]
+
+    set t_attr [bench::time_ms {
+        foreach i [ig::db::get_instances -all] {
+            foreach p [ig::db::get_pins -of $i -all] {
+                ig::db::get_attribute -object $p -attribute "connection"
+                ig::db::get_attribute -object $p -attribute "invert" -default "false"
+            }
+        }
+    }]
+
+    ig::db::reset
+
+    return [list \
+        "objects"          $n_objs \
+        "generate (ms)"    $t_gen \
+        "attr lookup (ms)" $t_attr \
+        "rss delta (kiB)"  [expr {$rss_after - $rss_before}] \
+        "bytes/object"     [expr {$n_objs > 0 ? ($rss_after - $rss_before) * 1024 / $n_objs : 0}] \
+    ]
+}
+
+bench::case "obj-lookup" "repeated object resolution of object-ids" {
+    set n_modules [bench::scaled 200]
+    set n_passes  10
+
+    bench::gen_hierarchy $n_modules 20
+
+    set pins [list]
+    foreach i [ig::db::get_instances -all] {
+        lappend pins {*}[ig::db::get_pins -of $i -all]
+    }
+
+    set t_lookup [bench::time_ms {
+        for {set p 0} {$p < $n_passes} {incr p} {
+            foreach pin $pins {
+                ig::db::get_attribute -object $pin -attribute "name"
+            }
+        }
+    }]
+
+    ig::db::reset
+
+    return [list \
+        "lookups"     [expr {[llength $pins] * $n_passes}] \
+        "lookup (ms)" $t_lookup \
+    ]
+}
+
+bench::case "arena" "instance build and teardown with refcounted vs. arena objects" {
+    set n_insts [bench::scaled 100000]
+    set result  [list "instances" $n_insts]
+
+    foreach {mode label} {"-no-arena" "refcount" "-arena" "arena"} {
+        ig::db::reset $mode
+
+        set t_build [bench::time_ms {
+            set top [ig::db::create_module -name "bench_top"]
+            set sub [ig::db::create_module -resource -name "bench_sub"]
+            for {set i 0} {$i < $n_insts} {incr i} {
+                ig::db::create_instance -name "bench_sub_i${i}" -of-module $sub -parent-module $top
+            }
+        }]
+        set t_clear [bench::time_ms {ig::db::reset}]
+
+        lappend result "${label} build (ms)" $t_build "${label} teardown (ms)" $t_clear
+    }
+
+    ig::db::reset -no-arena
+
+    return $result
+}
+
+bench::case "name-lookup" "construction and child lookup by name in modules with many ports" {
+    set n_signals [bench::scaled 2000]
+
+    set t_gen [bench::time_ms {bench::gen_hierarchy 2 $n_signals}]
+
+    set mod [ig::db::get_modules -name "bench_sub0"]
+    set t_lookup [bench::time_ms {
+        for {set s 0} {$s < $n_signals} {incr s} {
+            ig::db::get_ports -of $mod -name "sig0_${s}_o"
+        }
+    }]
+
+    ig::db::reset
+
+    return [list \
+        "ports/module"  [expr {2 * $n_signals}] \
+        "generate (ms)" $t_gen \
+        "lookup (ms)"   $t_lookup \
+    ]
+}
+
+bench::case "adapt-map" "signal name adaption of codesections in modules with many ports" {
+    set n_signals [bench::scaled 2000]
+    set n_code    [bench::scaled 200]
+
+    bench::gen_hierarchy 2 $n_signals
+
+    set mod   [ig::db::get_modules -name "bench_sub0"]
+    set codes [list]
+    for {set c 0} {$c < $n_code} {incr c} {
+        set cs [ig::db::add_codesection -parent-module $mod -code "assign sig0_${c}! = sig1_${c}!;"]
+        ig::db::set_attribute -object $cs -attribute "adapt" -value "selective"
+        lappend codes $cs
+    }
+
+    set t_adapt [bench::time_ms {
+        foreach cs $codes {
+            ig::aux::adapt_codesection $cs
+        }
+    }]
+
+    ig::db::reset
+
+    return [list \
+        "ports/module"  [expr {2 * $n_signals}] \
+        "codesections"  $n_code \
+        "adapt (ms)"    $t_adapt \
+    ]
+}
+
+bench::case "adapt-code" "signal name adaption of a large codesection" {
+    set n_lines [bench::scaled 5000]
+
+    set replace_map [dict create]
+    set code {}
+    for {set l 0} {$l < $n_lines} {incr l} {
+        dict set replace_map "sig_${l}" "sig_${l}_o"
+        append code "    assign sig_${l}! = (sel_i == 8'd[expr {$l % 256}]) ? data_i\[${l}\] : sig_[expr {$l / 2}]!;\n"
+    }
+
+    set t_selective [bench::time_ms {ig::aux::adapt_codesection_replace $code $replace_map true}]
+    set t_all       [bench::time_ms {ig::aux::adapt_codesection_replace $code $replace_map false}]
+
+    return [list \
+        "lines"          $n_lines \
+        "selective (ms)" $t_selective \
+        "all (ms)"       $t_all \
+    ]
+}
+
+bench::case "instance-expand" "repeated expansion of instance range expressions" {
+    set n_insts [bench::scaled 256]
+    set n_exprs [bench::scaled 200]
+
+    set top  [ig::db::create_module -name "bench_top"]
+    set core [ig::db::create_module -resource -name "core"]
+    for {set i 0} {$i < $n_insts} {incr i} {
+        ig::db::create_instance -name "core_${i}" -of-module $core -parent-module $top
+    }
+
+    set expr "core<0..[expr {$n_insts - 1}]>:sig"
+    set t_names [bench::time_ms {
+        for {set i 0} {$i < $n_exprs} {incr i} {
+            ig::construct::expand_instances [list $expr]
+        }
+    }]
+    set t_ids [bench::time_ms {
+        for {set i 0} {$i < $n_exprs} {incr i} {
+            ig::construct::expand_instances [list $expr] true true
+        }
+    }]
+
+    ig::db::reset
+
+    return [list \
+        "instances"    $n_insts \
+        "expressions"  $n_exprs \
+        "names (ms)"   $t_names \
+        "ids (ms)"     $t_ids \
+    ]
+}
+
+bench::case "parse-opts" "option parsing of signal-style command arguments" {
+    set n_calls [bench::scaled 50000]
+
+    proc ::bench::parse_signal_opts {args} {
+        set width 1
+        set value {}
+        set invert false
+        return [ig::aux::parse_opts {
+                { {^-w(idth)?(=)?}         "string"      width        "set signal width" }
+                { {^(-v(alue)?(=|$)|=)}    "string"      value        "assign value to signal" }
+                { {^-d(imension)?(=)?}     "string"      dimension    "multi-dimensional SV ports" }
+                { {^-s(ign(ed)?)?}         "const=true"  signed       "signed SV ports" }
+                { {^-(-)?>$}               "const=false" invert       "first element is interpreted as input source"}
+                { {^<(-)?-$}               "const=true"  invert       "last element is interpreted as input source"}
+            } -context "SIGNALNAME CONNECTIONPORTS..." $args]
+    }
+
+    set t_parse [bench::time_ms {
+        for {set i 0} {$i < $n_calls} {incr i} {
+            bench::parse_signal_opts "sig_${i}" "mod_a" "-->" "mod_b:port" -w8 "=32'h0"
+        }
+    }]
+
+    return [list \
+        "calls"        $n_calls \
+        "parse (ms)"   $t_parse \
+    ]
+}
+
+bench::case "fanout" "signals connected to many instances" {
+    set n_insts   [bench::scaled 2000]
+    set n_signals 10
+
+    set top [ig::db::create_module -name "bench_top"]
+    set insts [list]
+    for {set i 0} {$i < $n_insts} {incr i} {
+        set mod [ig::db::create_module -name "bench_sub${i}"]
+        lappend insts [ig::db::create_instance -name "bench_sub${i}" -of-module $mod -parent-module $top]
+    }
+
+    set t_connect [bench::time_ms {
+        for {set s 0} {$s < $n_signals} {incr s} {
+            ig::db::connect -from $top -to $insts -signal-name "fanout${s}" -signal-size 1
+        }
+    }]
+
+    ig::db::reset
+
+    return [list \
+        "fanout"       $n_insts \
+        "signals"      $n_signals \
+        "connect (ms)" $t_connect \
+    ]
+}
+
+bench::case "connect-batch" "bus signals created by single connect calls vs. one connect_batch call" {
+    set n_signals [bench::scaled 5000]
+    set result    [list "signals" $n_signals]
+
+    foreach mode {"single" "batch"} {
+        set top [ig::db::create_module -name "bench_top"]
+        set src [ig::db::create_instance -name "bench_src" -of-module [ig::db::create_module -name "bench_src"] -parent-module $top]
+        set dst [ig::db::create_instance -name "bench_dst" -of-module [ig::db::create_module -name "bench_dst"] -parent-module $top]
+
+        set specs [list]
+        for {set s 0} {$s < $n_signals} {incr s} {
+            lappend specs [list -from $src -to [list $dst] -signal-name "bus${s}" -signal-size 32]
+        }
+
+        if {$mode eq "single"} {
+            set t_connect [bench::time_ms {
+                foreach spec $specs {
+                    ig::db::connect {*}$spec
+                }
+            }]
+        } else {
+            set t_connect [bench::time_ms {ig::db::connect_batch -signals $specs}]
+        }
+
+        ig::db::reset
+
+        lappend result "${mode} (ms)" $t_connect
+    }
+
+    return $result
+}
+
+bench::case "attr-bulk" "attribute access per object vs. one get_attributes_bulk call" {
+    set n_modules [bench::scaled 200]
+
+    bench::gen_hierarchy $n_modules 20
+
+    set pins [list]
+    foreach i [ig::db::get_instances -all] {
+        lappend pins {*}[ig::db::get_pins -of $i -all]
+    }
+
+    set t_single [bench::time_ms {
+        foreach p $pins {
+            ig::db::get_attribute -object $p -attribute "name"
+            ig::db::get_attribute -object $p -attribute "connection"
+            ig::db::get_attribute -object $p -attribute "invert" -default "false"
+        }
+    }]
+    set t_bulk [bench::time_ms {
+        ig::db::get_attributes_bulk -objects $pins -attributes {"name" "connection" {"invert" "false"}}
+    }]
+
+    ig::db::reset
+
+    return [list \
+        "objects"     [llength $pins] \
+        "single (ms)" $t_single \
+        "bulk (ms)"   $t_bulk \
+    ]
+}
+
+bench::case "template-run" "repeated output generation with the default verilog template" {
+    set n_modules [bench::scaled 200]
+
+    ig::templates::add_template_dir [file join [file dirname [file dirname [file normalize $::argv0]]] templates]
+    ig::templates::load_template "default"
+
+    bench::gen_hierarchy $n_modules 5
+    foreach d [ig::db::get_declarations -of [ig::db::get_modules -name "bench_top"] -all] {
+        ig::db::set_attribute -object $d -attribute "nettype" -value ""
+    }
+
+    set typelist [ig::templates::process_outtypelist [list "vlog-v"]]
+    set t_run [bench::time_ms {
+        foreach m [ig::db::get_modules -all] {
+            ig::templates::write_object_all $m $typelist true
+        }
+    }]
+
+    ig::db::reset
+
+    return [list \
+        "outputs"       [expr {$n_modules + 1}] \
+        "generate (ms)" $t_run \
+    ]
+}
+
+bench::case "template-parse" "repeated parsing of all default templates into tcl code" {
+    set n_runs [bench::scaled 50]
+
+    set tdir [file join [file dirname [file dirname [file normalize $::argv0]]] templates "default"]
+    set ig::templates::current::template_dir $tdir
+
+    set templates [list]
+    foreach f [lsort [glob -directory $tdir "*/template.*"]] {
+        set fh [open $f "r"]
+        lappend templates $f [read $fh]
+        close $fh
+    }
+
+    set t_parse [bench::time_ms {
+        for {set i 0} {$i < $n_runs} {incr i} {
+            foreach {f txt} $templates {
+                if {[string match "*.wtf.*" [file tail $f]]} {
+                    ig::templates::parse_wtf $txt $f
+                } else {
+                    ig::templates::parse_template $txt $f
+                }
+            }
+        }
+    }]
+
+    set ig::templates::current::template_dir ""
+
+    return [list \
+        "templates"  [expr {[llength $templates] / 2}] \
+        "runs"       $n_runs \
+        "parse (ms)" $t_parse \
+    ]
+}
+
+bench::case "regfile-export" "preprocessing of a large regfile into template array-lists" {
+    set n_entries [bench::scaled 5000]
+
+    set mod [ig::db::create_module -name "bench_rf"]
+    set rf  [ig::db::add_regfile -regfile "bench_rf" -to $mod]
+    ig::db::set_attribute -object $rf -attributes {"datawidth" 32}
+    for {set e 0} {$e < $n_entries} {incr e} {
+        set entry [ig::db::add_regfile -entry "entry${e}" -to $rf]
+        ig::db::set_attribute -object $entry -attributes [list "address" [expr {4 * $e}] "comment" ""]
+        foreach {reg attrs} {"ctrl" {"rf_width" 1} "mode" {"rf_width" 3} "value" {"rf_entrybits" "23:8" "rf_type" "R"} "status" {"rf_width" 4}} {
+            ig::db::set_attribute -object [ig::db::add_regfile -reg $reg -to $entry] -attributes $attrs
+        }
+    }
+
+    set t_export [bench::time_ms {ig::templates::preprocess::regfile_to_arraylist $rf}]
+
+    ig::db::reset
+
+    return [list \
+        "registers"   [expr {4 * $n_entries}] \
+        "export (ms)" $t_export \
+    ]
+}
+
+bench::case "regfile-checks" "address and register bit overlap checks of a large regfile" {
+    set n_entries [bench::scaled 2000]
+
+    set entries [list]
+    for {set e 0} {$e < $n_entries} {incr e} {
+        set regs [list]
+        foreach {reg low high} {"ctrl" 0 0 "mode" 1 3 "value" 8 23 "status" 24 27} {
+            lappend regs [list "name" $reg "bit_low" $low "bit_high" $high]
+        }
+        lappend entries [list "name" "entry${e}" "address" [expr {4 * $e}] "object" {} "regs" $regs]
+    }
+    set rfdata [list "name" "bench_rf" "addrwidth" 32 "addralign" 4 "datawidth" 32 "entries" $entries]
+
+    set t_addr [bench::time_ms {ig::checks::check_regfile_addresses $rfdata}]
+    set t_bits [bench::time_ms {ig::checks::check_regfile_entrybits $rfdata}]
+
+    return [list \
+        "entries"        $n_entries \
+        "addresses (ms)" $t_addr \
+        "entrybits (ms)" $t_bits \
+    ]
+}
+
+#-------------------------------------------------------
+# main
+proc main {} {
+    ig::logger -level E
+
+    set selected [list]
+    for {set i 0} {$i < $::argc} {incr i} {
+        set arg [lindex $::argv $i]
+        if {$arg eq "-scale"} {
+            set bench::scale [lindex $::argv [incr i]]
+        } else {
+            lappend selected $arg
+        }
+    }
+
+    foreach {name description} $bench::cases {
+        if {([llength $selected] > 0) && ($name ni $selected)} {
+            continue
+        }
+
+        puts "${name}: ${description}"
+        foreach {label value} [bench::case_${name}] {
+            puts [format "    %-24s %12s" $label $value]
+        }
+    }
+}
+
+main
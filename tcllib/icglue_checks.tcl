@@ -189,9 +189,17 @@ namespace eval ig::checks {
         set entries   [dict get $regfile_data "entries"]
         set addrwidth [dict get $regfile_data "addrwidth"]
         set alignment [dict get $regfile_data "addralign"]
-        set addr_list [list]
 
+        # entries overlap if their addresses are in the same aligned address block
+        set addr_blocks [list]
         foreach i_entry $entries {
+            set address [dict get $i_entry "address"]
+            set iaddr   [expr {int($address / $alignment) * $alignment}]
+            lappend addr_blocks [list {} $iaddr [expr {$iaddr + $alignment - 1}]]
+        }
+        set addr_overlaps [ig::util::interval_overlaps -intervals $addr_blocks]
+
+        foreach i_entry $entries overlaps $addr_overlaps {
             set name    [dict get $i_entry "name"]
             set address [dict get $i_entry "address"]
             set oid     [dict get $i_entry "object"]
@@ -211,17 +219,9 @@ namespace eval ig::checks {
             }
 
             # check if existing
-            set idx [lsearch -exact -integer -index 0 $addr_list $address]
-            if {$idx >= 0} {
-                lassign [lindex $addr_list $idx] o_address o_name
+            if {[llength $overlaps] > 0} {
+                set o_name [dict get [lindex $entries [lindex $overlaps 0]] "name"]
                 ig::log -warn -id "ChkRA" "regfile entries \"${o_name}\" and \"${name}\" overlap at address [format "0x%08x" $address] (regfile ${rfname}) (${origin})"
-                continue
-            }
-
-            # add to list
-            for {set i 0} {$i < $alignment} {incr i} {
-                set iaddr [expr {int($address / $alignment) * $alignment + $i}]
-                lappend addr_list [list $iaddr $name]
             }
         }
     }
@@ -234,6 +234,20 @@ namespace eval ig::checks {
 
         set wordsize [dict get $regfile_data "datawidth"]
 
+        # register bit ranges of all entries (keyed by entry index)
+        set reg_bits  [list]
+        set reg_names [list]
+        set eidx 0
+        foreach i_entry $entries {
+            foreach i_reg [dict get $i_entry "regs"] {
+                lappend reg_bits  [list $eidx [dict get $i_reg "bit_low"] [dict get $i_reg "bit_high"]]
+                lappend reg_names [dict get $i_reg "name"]
+            }
+            incr eidx
+        }
+        set reg_overlaps [ig::util::interval_overlaps -intervals $reg_bits]
+
+        set ridx 0
         foreach i_entry $entries {
             set ename [dict get $i_entry "name"]
             set regs  [dict get $i_entry "regs"]
@@ -243,29 +257,21 @@ namespace eval ig::checks {
                 set origin [ig::db::get_attribute -object $oid -attribute "origin" -default {}]
             }
 
-            set bit_list [list]
-
             foreach i_reg $regs {
                 set rname [dict get $i_reg "name"]
-                set blow  [dict get $i_reg "bit_low"]
                 set bhigh [dict get $i_reg "bit_high"]
 
                 if {$bhigh >= $wordsize} {
                     ig::log -warn -id "ChkRB" "register \"${rname}\" in entry \"${ename}\" exceeds wordsize of ${wordsize} (MSB = ${bhigh}, regfile ${rfname}) (${origin})"
                 }
 
-                for {set i $blow} {$i <= $bhigh} {incr i} {
-                    # check if existing
-                    set idx [lsearch -exact -integer -index 0 $bit_list $i]
-                    if {$idx >= 0} {
-                        lassign [lindex $bit_list $idx] o_bit o_name
+                foreach {o_idx o_low o_high} [lindex $reg_overlaps $ridx] {
+                    set o_name [lindex $reg_names $o_idx]
+                    for {set i $o_low} {$i <= $o_high} {incr i} {
                         ig::log -warn -id "ChkRB" "registers \"${rname}\" and \"${o_name}\" in entry \"${ename}\" overlap at bit ${i} (regfile ${rfname}) (${origin})"
-                        continue
                     }
-
-                    # add to list
-                    lappend bit_list [list $i $rname]
                 }
+                incr ridx
             }
         }
     }
@@ -293,6 +299,10 @@ namespace eval ig::checks {
             dict set msigdata $s "-"
         }
 
+        # written signal bits for overlap check
+        set sig_bits [list]
+        set sig_regs [list]
+
         foreach i_entry $entries {
             set ename [dict get $i_entry "name"]
             set regs  [dict get $i_entry "regs"]
@@ -353,6 +363,27 @@ namespace eval ig::checks {
                 if {($bhigh - $blow) != ($shigh - $slow)} {
                     ig::log -warn -id "ChkRS" "register \"${rname}\" in entry \"${ename}\" connects to non-matching bits of signal (${bhigh}:${blow} <-> $sbits, regfile ${rfname}) (${origin})"
                 }
+
+                # signal bits driven by register
+                if {$wtype && [string is integer -strict $slow] && [string is integer -strict $shigh]} {
+                    lappend sig_bits [list $sig $slow $shigh]
+                    lappend sig_regs [list $rname $ename $origin]
+                }
+            }
+        }
+
+        # registers driving overlapping bits of the same signal
+        set sig_overlaps [ig::util::interval_overlaps -intervals $sig_bits]
+        foreach i_bits $sig_bits i_reg $sig_regs overlaps $sig_overlaps {
+            set sig [lindex $i_bits 0]
+            lassign $i_reg rname ename origin
+
+            foreach {o_idx o_low o_high} $overlaps {
+                set o_rname [lindex $sig_regs $o_idx 0]
+                set o_ename [lindex $sig_regs $o_idx 1]
+                if {$o_low == $o_high} {set obits $o_low} else {set obits "${o_high}:${o_low}"}
+
+                ig::log -warn -id "ChkRS" "registers \"${rname}\" in entry \"${ename}\" and \"${o_rname}\" in entry \"${o_ename}\" drive overlapping bits of signal (${sig}\[${obits}\], regfile ${rfname}) (${origin})"
             }
         }
     }
@@ -40,76 +40,13 @@ namespace eval ig {
         # If there is no instance of the given instance-name to be found, a module id will be looked up.
         # If merge is set as well, the result-list will be reduced to a single entry for each instance of the form [~]${id}:signal.
         proc expand_instances {inst_list {ids false} {merge false} {num_separator "_"}} {
-            set result [list]
-
-            foreach i_entry $inst_list {
-                if {[regexp -expanded {
-                    ^
-                    ([~]?)
-                    ([^<>:]+)
-                    (<(.*)>)?
-                    (:[^\s]+)?
-                    $
-                } $i_entry m_entry m_inv m_module m_instwrap m_insts m_rem]} {
-                    if {$m_instwrap eq ""} {
-                        lappend result [list $m_module $m_module $m_rem $m_inv]
-                    } else {
-                        foreach i_sfx [split $m_insts ","] {
-                            set expand_range "true"
-                            set insts [list [string trim $i_sfx]]
-                            while {$expand_range} {
-                                set insts_new {}
-                                set expand_range "false"
-                                foreach i_inst $insts {
-                                    if {[regexp {^(\w*?)(\d+)\.\.(\d+)([[:alnum:]_.]*?)$} $i_inst m_whole m_prefix m_start m_stop m_suffix]} {
-                                        # swap if start > stop
-                                        if {$m_start > $m_stop} {lassign [list $m_start $m_stop] m_stop m_start}
-
-                                        for {set i $m_start} {$i <= $m_stop} {incr i} {
-                                            lappend insts_new "${m_prefix}${i}${m_suffix}"
-                                        }
-                                        set expand_range "true"
-                                    } else {
-                                        lappend insts_new $i_inst
-                                    }
-                                }
-                                set insts $insts_new
-                            }
-
-                            foreach i_sfx $insts {
-                                lappend result [list "${m_module}${num_separator}${i_sfx}" $m_module $m_rem $m_inv]
-                            }
-                        }
-                    }
-                } else {
-                    error "ig::construct::expand_instances: could not parse $i_entry (arg \$inst_list =  $inst_list)"
-                }
-            }
-
-            if {$ids} {
-                set result_ids [list]
-
-                foreach i_r $result {
-                    set inst [lindex $i_r 0]
-                    if {[catch {set inst_id [ig::db::get_instances -name $inst]}]} {
-                        set inst_id [ig::db::get_modules -name $inst]
-                    }
-                    if {$merge} {
-                        lappend result_ids "[lindex $i_r 3]${inst_id}[lindex $i_r 2]"
-                    } else {
-                        lappend result_ids [list \
-                            $inst_id \
-                            [ig::db::get_modules -name [lindex $i_r 1]] \
-                            [lindex $i_r 2] \
-                            [lindex $i_r 3]
-                        ]
-                    }
-                }
-
-                set result $result_ids
+            if {!$ids} {
+                return [ig::db::expand_instances -expressions $inst_list -separator $num_separator]
+            } elseif {$merge} {
+                return [ig::db::expand_instances -expressions $inst_list -separator $num_separator -ids -merge]
+            } else {
+                return [ig::db::expand_instances -expressions $inst_list -separator $num_separator -ids]
             }
-
-            return $result
         }
 
         ## @brief Common proc to parse module/rf attribute string in module tree
@@ -274,11 +211,11 @@ namespace eval ig {
                 set fres "false"
                 set finc "false"
                 set moduleflags [regsub -all {\s+} ${moduleflags} {}]
-                ig::aux::parse_opts [list                    \
+                ig::aux::parse_opts {                       \
                     { {^(ilm|macro)$} "const=true" film {} } \
                     { {^res(ource)?$} "const=true" fres {} } \
                     { {^inc(lude)?$}  "const=true" finc {} } \
-                    ] [split $moduleflags ","]
+                    } [split $moduleflags ","]
 
                 set cf [list ]
                 if {$fres} {
@@ -342,7 +279,7 @@ namespace eval ig {
                 }
 
                 set moduleflags [regsub -all {([^\\]),\s*} $moduleflags "\\1\n"]
-                set funknown [ig::aux::parse_opts [list                                        \
+                set funknown [ig::aux::parse_opts {                                           \
                     { {^u(nit)?(=|$)}                     "string"              funit         {} }  \
                     { {^(ilm|macro)$}                     "const=true"          film          {} }  \
                     { {^res(ource)?$}                     "const=true"          fres          {} }  \
@@ -369,7 +306,7 @@ namespace eval ig {
                                                                                                     \
                     { {^o(ut)?(typ(es)?|tags)(=|$)}       "string"              fotypes       {} }  \
                     { {^rfo(ut)?(typ(es)?|tags)(=|$)}     "string"              frfotypes     {} }  \
-                    ] [split $moduleflags "\n"]]
+                    } [split $moduleflags "\n"]]
 
                 if {[llength $funknown] != 0} {
                     ig::log -abort -error -id MTree "M (instance $instance_name): Unknown flag(s) - $funknown ($origin)"
@@ -941,7 +878,7 @@ namespace eval ig {
         set origin        [ig::aux::get_origin_here]
 
         # parse_opts { <regexp> <argumenttype/check> <varname> <description> }
-        set name [ig::aux::parse_opts [list                                                                                           \
+        set name [ig::aux::parse_opts {                                                                                              \
                    { {^-u(nit)?(=|$)}                     "string"              unit          "specify unit name \[directory\]"       }   \
                    { {^-i(nst(ances|anciate)?)?(=|$)}     "string"              instances     "specify Module to be instanciated"     }   \
                    { {^-tree(=)?}                         "string"              instance_tree "specify module instance tree"          }   \
@@ -971,7 +908,7 @@ namespace eval ig {
                    { {^-rfo(typ(es)?|tags)(=|$)}          "string"              rfotypes      "default regfile output types"          }   \
                                                                                                                                           \
                    { {^-cmdorigin(=|$)}                   "string"              origin        "origin of command call for logging"    }   \
-            ] -context "MODULENAME" $args]
+            } -context "MODULENAME" $args]
 
 
         # argument checks
@@ -1090,7 +1027,7 @@ namespace eval ig {
         set origin       [ig::aux::get_origin_here]
 
         # parse_opts { <regexp> <argumenttype/check> <varname> <description> }
-        set arguments [ig::aux::parse_opts [list                                                                      \
+        set arguments [ig::aux::parse_opts {                                                                         \
                 { {^-w(idth)?(=)?}         "string"      width        "set signal width" }                            \
                 { {^(-v(alue)?(=|$)|=)}    "string"      value        "assign value to signal" }                      \
                 { {^-d(imension)?(=)?}     "string"      dimension    "multi-dimensional SV ports" }                  \
@@ -1102,7 +1039,7 @@ namespace eval ig {
                 { {^<(-)?-$}               "const=true"  invert       "last element is interpreted as input source"}  \
                 { {^-p(in)?$}              "const=true"  resource_pin "add a pin to a resource module"}               \
                 { {^-cmdorigin(=|$)}       "string"      origin       "origin of command call for logging"}           \
-            ] -context "SIGNALNAME CONNECTIONPORTS..." $args]
+            } -context "SIGNALNAME CONNECTIONPORTS..." $args]
 
         set name [lindex $arguments 0]
         # argument checks
@@ -1271,10 +1208,10 @@ namespace eval ig {
         set origin    [ig::aux::get_origin_here]
 
         # parse_opts { <regexp> <argumenttype/check> <varname> <description> }
-        set params [ig::aux::parse_opts [list                                                   \
+        set params [ig::aux::parse_opts {                                                      \
                    { {^(=|-v(alue)?)(=)?} "string" value  "specify parameter value" }           \
                    { {^-cmdorigin(=|$)}   "string" origin "origin of command call for logging"} \
-            ] -context "PARAMETERNAME MODULENAME..." $args]
+            } -context "PARAMETERNAME MODULENAME..." $args]
 
         set name [lindex $params 0]
 
@@ -1364,7 +1301,7 @@ namespace eval ig {
         set do_ws_trim    "false"
 
         # parse_opts { <regexp> <argumenttype/check> <varname> <description> }
-        set arguments [ig::aux::parse_opts [list \
+        set arguments [ig::aux::parse_opts {    \
                 { {^-a(dapt)?$}                   "const=all"       adapt          "adapt signal names"                                               } \
                 { {^-no(-)?a(dapt)?$}             "const=none"      adapt          "do not adapt signal names"                                        } \
                 { {^-a(dapt-)?s(elective(ly)?)?$} "const=selective" adapt          "selectively adapt signal names followed by \"!\""                 } \
@@ -1376,7 +1313,7 @@ namespace eval ig {
                 { {^-noi(ndentfix)?$}             "const=false"     do_indent_fix  "do not fix the indent of the codeblock"                           } \
                 { {^-cmdorigin(=|$)}              "string"          origin         "origin of command call for logging"                               } \
                 { {^-t(rim)?$}                    "const=true"      do_ws_trim     "trim whitespaces and newlines around codesections"                } \
-            ] -context "MODULENAME CODE" $args]
+            } -context "MODULENAME CODE" $args]
 
         # argument checks
         set modname [lindex $arguments 0]
@@ -1482,7 +1419,7 @@ namespace eval ig {
         set features            {}
 
         # parse_opts { <regexp> <argumenttype/check> <varname> <description> }
-        set arguments [ig::aux::parse_opts [list \
+        set arguments [ig::aux::parse_opts {    \
                 { {^-(rf|regf(ile)?)($|=)}  "string"             regfilename    "DEPRECATED: specify the regfile name, dispenses REGFILE-MODULE argument "          } \
                 { {^(@|-addr($|=))}         "string"             address        "specify the address"                                                               } \
                 { {^-align($|=)}            "integer"            register_align "alignment of address at a multiple of the given number of registers"               } \
@@ -1495,7 +1432,7 @@ namespace eval ig {
                 { {^-comm(ent)?(=|$)}       "string"             comm           "comment for register"                                                              } \
                 { {^-subst_uplevel}         "integer"            subst_level    "uplevel for substition"                                                            } \
                 { {^-features?}              "string"             features       "additional features entry (columns)"                                               } \
-            ] -context "REGFILE-MODULE ENTRYNAME REGISTERTABLE" $args]
+            } -context "REGFILE-MODULE ENTRYNAME REGISTERTABLE" $args]
 
         if {$regfilename ne ""} {
             set entryname [lindex $arguments 0]
@@ -1814,7 +1751,7 @@ namespace eval ig {
         set regname      "value"
 
         # parse_opts { <regexp> <argumenttype/check> <varname> <description> }
-        set arguments [ig::aux::parse_opts [list \
+        set arguments [ig::aux::parse_opts {    \
                 { {^-w(idth)?(=)?}                 "string"       width     "set signal width"                                                    } \
                 { {^-(-)?\>$}                      "const=-->"    dir       "first element is interpreted as input source"                        } \
                 { {^<(-)?-$}                       "const=<--"    dir       "last element is interpreted as input source"                         } \
@@ -1826,7 +1763,7 @@ namespace eval ig {
                 { {^(=|-v(alue)?|-r(eset(val)?)?)} "string"       resetval  "specify reset value for the register"                                } \
                 { {^-cmdorigin(=|$)}               "string"       origin    "origin of command call for logging"                                  } \
                 { {^-(reg)?n(ame)?(=|$)}           "string"       regname    "name of register (default: value)"                                  } \
-            ] -context "SIGNALNAME CONNECTIONPORTS..." $args]
+            } -context "SIGNALNAME CONNECTIONPORTS..." $args]
 
         set rf_args {"-nosubst"}
         if {$address ne ""} {
@@ -1969,7 +1906,7 @@ namespace eval ig {
         set origin      [ig::aux::get_origin_here]
 
         # parse_opts { <regexp> <argumenttype/check> <varname> <description> }
-        set arguments [ig::aux::parse_opts [list \
+        set arguments [ig::aux::parse_opts {    \
                 { {^-(rf|regf(ile)?)($|=)} "string"          regfilename "specify the regfile name"                                                          } \
                 { {^-csv$}                 "const=csv"       mode        "specify entries as csv"                                                            } \
                 { {^-csvfile($|=)}         "string"          csvfile     "specify entries as csvfile"                                                        } \
@@ -1984,7 +1921,7 @@ namespace eval ig {
                 { {^-nos(ubst)?$}          "const=-nosubst"  subst_opt   "do not perform Tcl-variable substition in REGISTERTABLE argument"                  } \
                 { {^-e(val(uate)?)?$}      "const=-evaluate" eval_opt    "perform Tcl-command substition of REGISTERTABLE argument, do not forget to escape" } \
                 { {^-cmdorigin(=|$)}       "string"          origin      "origin of command call for logging"                                                } \
-            ] -context "REGFILE-MODULE REGISTERTABLE" $args]
+            } -context "REGFILE-MODULE REGISTERTABLE" $args]
 
         if {$regfilename ne ""} {
             set regtable    [lindex $arguments 0]
@@ -51,122 +51,82 @@ namespace eval ig::aux {
     #
     # @return Argument without a match
     proc _parse_opts {cmdname helpcontext optspec arguments {level 1}} {
-        set retval {}
-        array set opt {}
+        lassign [ig::util::parse_opts -spec $optspec -arguments $arguments] retval opt help
 
-        while {[llength $arguments] > 0} {
-            set arg [lindex $arguments 0]
-            set arguments [lrange $arguments 1 end]
-            set found 0
-            foreach o $optspec {
+        if {$help ne ""} {
+            _parse_opts_help $cmdname $helpcontext $optspec $help
+        }
 
-                # option listing goes here (<regex> <type>[const=value|TCL-TYPE] <up-varname> <description>:
+        dict for {upvarname upvarvalue} $opt {
+            uplevel $level set $upvarname [list $upvarvalue]
+        }
+
+        return $retval
+    }
+
+    ## @brief Option parser helper: generate help message
+    #
+    # @param cmdname        Commandname to be printed for the help message
+    # @param helpcontext    Helpcontext to be printed [arguments]
+    # @param optspec        Option specification
+    # @param arg            Help option ("-help" or "-helpdoxy")
+    #
+    # Throws an error with the help message.
+    proc _parse_opts_help {cmdname helpcontext optspec arg} {
+        if {$arg eq "-help"} {
+            set helpmsg {}
+            lappend helpmsg "Usage: $cmdname \[OPTION\]... $helpcontext"
+            set optlist {}
+            set opthelpname_maxlen 0
+            foreach o $optspec {
                 set opt_regex [lindex $o 0]
-                set opt_type  [lindex $o 1]
-                set opt_var   [lindex $o 2]
                 set opt_descr [lindex $o 3]
-                set index [regexp $opt_regex $arg match]
-                if {$index > 0} {
-                    set found 1
-                    set typelist [split $opt_type =]
-                    set type [lindex $typelist 0]
-                    if {$type eq "const"} {
-                        set opt([lindex $o 2]) [lindex $typelist 1]
-                    } else {
-                        set len_match [string length $match]
-                        set len_arg   [string length $arg]
-                        if {$len_match == $len_arg} {
-                            if {[llength $arguments] == 0} {
-                                error "Option [opt_regex_to_helpname $opt_regex] expects an argument"
-                            }
-                            set arg [lindex $arguments 0]
-                            set arguments [lrange $arguments 1 end]
-                        } else {
-                            set arg [string range $arg $len_match end]
-                        }
-                        if {($type ne "string") && ($type ne "list") && (![string is $type $arg])} {
-                            error "Option [opt_regex_to_helpname $opt_regex] expects value of type $type but got: $arg"
-                        }
-                        if {$type eq "list"} {
-                            lappend opt($opt_var) $arg
-                        } else {
-                            set opt($opt_var) $arg
-                        }
-                    }
-                    break;
+                set opthelpname [opt_regex_to_helpname $opt_regex]
+                set opthelpname_len [string length $opthelpname]
+                if {$opthelpname_maxlen < $opthelpname_len} {
+                    set opthelpname_maxlen $opthelpname_len
                 }
+                lappend optlist $opthelpname
+                lappend optlist $opt_descr
             }
 
-            if {$found == 1} {
-                continue;
+            foreach {opt_name opt_descr} $optlist {
+                lappend helpmsg [format "  %-${opthelpname_maxlen}s %s" $opt_name $opt_descr]
             }
-
-            # check for default help
-            if {[regexp ^-h(elp)?$ $arg]} {
-                set helpmsg {}
-                lappend helpmsg "Usage: $cmdname \[OPTION\]... $helpcontext"
-                set optlist {}
-                set opthelpname_maxlen 0
-                foreach o $optspec {
-                    set opt_regex [lindex $o 0]
-                    set opt_descr [lindex $o 3]
-                    set opthelpname [opt_regex_to_helpname $opt_regex]
-                    set opthelpname_len [string length $opthelpname]
-                    if {$opthelpname_maxlen < $opthelpname_len} {
-                        set opthelpname_maxlen $opthelpname_len
-                    }
-                    lappend optlist $opthelpname
-                    lappend optlist $opt_descr
-                }
-
-                foreach {opt_name opt_descr} $optlist {
-                    lappend helpmsg [format "  %-${opthelpname_maxlen}s %s" $opt_name $opt_descr]
-                }
-                set helpmsg [join $helpmsg "\n"]
-                error $helpmsg
-                break;
-            } elseif {$arg eq "-helpdoxy"} {
-                set helpmsg {}
-                lappend helpmsg "    # @param args <b> \[OPTION\]... $helpcontext</b><br>"
-                lappend helpmsg "    #    <table style=\"border:0px; border-spacing:40px 0px;\">"
-                lappend helpmsg "    #      <tr><td><b> __TODO__ HELPCONTEXT </b></td><td> __TODO__ ARGUMENT DESCRIPTION <br></td></tr>"
-                lappend helpmsg "    #      <tr><td><b> OPTION </b></td><td><br></td></tr>"
-                set optlist {}
-                set opthelpname_maxlen 0
-                set optdescr_maxlen 0
-                foreach o $optspec {
-                    set opt_regex [lindex $o 0]
-                    set opt_descr [lindex $o 3]
-                    set opthelpname [opt_regex_to_helpname $opt_regex]
-                    set opthelpname_len [string length $opthelpname]
-                    if {$opthelpname_maxlen < $opthelpname_len} {
-                        set opthelpname_maxlen $opthelpname_len
-                    }
-                    set optdescr_len [string length $opt_descr]
-                    if {$optdescr_maxlen < $optdescr_len} {
-                        set optdescr_maxlen $optdescr_len
-                    }
-                    lappend optlist $opthelpname
-                    lappend optlist $opt_descr
+            set helpmsg [join $helpmsg "\n"]
+            error $helpmsg
+        } elseif {$arg eq "-helpdoxy"} {
+            set helpmsg {}
+            lappend helpmsg "    # @param args <b> \[OPTION\]... $helpcontext</b><br>"
+            lappend helpmsg "    #    <table style=\"border:0px; border-spacing:40px 0px;\">"
+            lappend helpmsg "    #      <tr><td><b> __TODO__ HELPCONTEXT </b></td><td> __TODO__ ARGUMENT DESCRIPTION <br></td></tr>"
+            lappend helpmsg "    #      <tr><td><b> OPTION </b></td><td><br></td></tr>"
+            set optlist {}
+            set opthelpname_maxlen 0
+            set optdescr_maxlen 0
+            foreach o $optspec {
+                set opt_regex [lindex $o 0]
+                set opt_descr [lindex $o 3]
+                set opthelpname [opt_regex_to_helpname $opt_regex]
+                set opthelpname_len [string length $opthelpname]
+                if {$opthelpname_maxlen < $opthelpname_len} {
+                    set opthelpname_maxlen $opthelpname_len
                 }
-
-                foreach {opt_name opt_descr} $optlist {
-                    lappend helpmsg [format "    #      <tr><td><i> &ensp; &ensp; %-${opthelpname_maxlen}s  </i></td><td>  %-${optdescr_maxlen}s <br></td></tr>" $opt_name $opt_descr]
+                set optdescr_len [string length $opt_descr]
+                if {$optdescr_maxlen < $optdescr_len} {
+                    set optdescr_maxlen $optdescr_len
                 }
-                lappend helpmsg "    #    </table>"
-                set helpmsg [join $helpmsg "\n"]
-                error $helpmsg
-                break;
+                lappend optlist $opthelpname
+                lappend optlist $opt_descr
             }
 
-            lappend retval $arg
-        }
-
-        foreach {upvarname upvarvalue} [array get opt] {
-            uplevel $level set $upvarname [list $upvarvalue]
+            foreach {opt_name opt_descr} $optlist {
+                lappend helpmsg [format "    #      <tr><td><i> &ensp; &ensp; %-${opthelpname_maxlen}s  </i></td><td>  %-${optdescr_maxlen}s <br></td></tr>" $opt_name $opt_descr]
+            }
+            lappend helpmsg "    #    </table>"
+            set helpmsg [join $helpmsg "\n"]
+            error $helpmsg
         }
-
-        return $retval
     }
 
     ## @brief Option parser helper wrapper
@@ -214,15 +174,19 @@ namespace eval ig::aux {
             set cmdname [lindex [info level -1] 0]
         }
 
-        set optspec [list                                                                                       \
-                    { {^-name(=)?}      "string"  cmdname     "specfiy a command name for the helpmsg"}         \
-                    { {^-context(=)?}   "string"  helpcontext "specfiy a helpcontext for the helpmsg"}          \
-                ]                                                                                               \
-
+        # literal specifications: the compiled specification stays cached in the literal
         if {[llength $args] != 1} {
-            lappend optspec \
-                { {^-h(elp)?$}   "const=1" help        "generate help message for the caller"}              \
-                { {^-helpdoxy$}  "const=1" helpdoxy    "generate template for doxygen help for the caller"} \
+            set optspec {
+                { {^-name(=)?}      "string"  cmdname     "specfiy a command name for the helpmsg"}
+                { {^-context(=)?}   "string"  helpcontext "specfiy a helpcontext for the helpmsg"}
+                { {^-h(elp)?$}      "const=1" help        "generate help message for the caller"}
+                { {^-helpdoxy$}     "const=1" helpdoxy    "generate template for doxygen help for the caller"}
+            }
+        } else {
+            set optspec {
+                { {^-name(=)?}      "string"  cmdname     "specfiy a command name for the helpmsg"}
+                { {^-context(=)?}   "string"  helpcontext "specfiy a helpcontext for the helpmsg"}
+            }
         }
 
         set helpcontext {}
@@ -515,24 +479,7 @@ namespace eval ig::aux {
     #
     # @return Replacement map as dict.
     proc adapt_replacement_map {module} {
-        set replace_map [dict create]
-
-        foreach {k_attr o_list} [list \
-            "signal"    [ig::db::get_ports -of $module -all] \
-            "signal"    [ig::db::get_declarations -of $module -all] \
-            "parameter" [ig::db::get_parameters -of $module -all] \
-        ] {
-            foreach i_elem $o_list {
-                set k [ig::db::get_attribute -object $i_elem -attribute $k_attr -default ""]
-                set v [ig::db::get_attribute -object $i_elem -attribute "name"]
-
-                if {$k ne ""} {
-                    dict set replace_map $k $v
-                }
-            }
-        }
-
-        return $replace_map
+        return [ig::db::get_local_names -of $module]
     }
 
     ## @brief Adapt signalnames in a codesection object if adapt-attribute is set.
@@ -637,30 +584,14 @@ namespace eval ig::aux {
     #
     # @return adapted code.
     proc adapt_codesection_replace {code replace_map {selective true} {origin {}}} {
-        # adapt signal-names
         if {$selective} {
-            set re {^(.*?)(\m[[:alnum:]_]+\M)\!(.*)$}
+            lassign [ig::util::adapt_code -code $code -map $replace_map -selective] code_out unresolved
         } else {
-            set re {^(.*?)(\m[[:alnum:]_]+\M)(.*)$}
-        }
-
-        set code_out {}
-        while {[string length $code] > 0} {
-            if {[regexp $re $code m_whole m_pre m_var m_post]} {
-                append code_out $m_pre
-                set    code     $m_post
-                if {![dict exists $replace_map $m_var]} {
-                    append code_out $m_var
-                    if {$selective} {
-                        ig::log -warn -id "TACAd" "selective adaption in codesection failed: signal \"$m_var\" not found ($origin)"
-                    }
-                } else {
-                    append code_out [dict get $replace_map $m_var]
-                }
-            } else {
-                append code_out $code
-                set code {}
-            }
+            lassign [ig::util::adapt_code -code $code -map $replace_map] code_out unresolved
+        }
+
+        foreach m_var $unresolved {
+            ig::log -warn -id "TACAd" "selective adaption in codesection failed: signal \"$m_var\" not found ($origin)"
         }
 
         return $code_out
@@ -762,8 +762,8 @@ namespace eval ig::sng {
         set vlog [read $f]
         close $f
 
-        set icg_blocks [ig::templates::parse_keep_blocks $vlog ".v"]
-        if {[llength $icg_blocks] > 0} {
+        set icg_blocks [ig::templates::parse_keep_blocks $vlog [ig::templates::comment_begin_end ".v"]]
+        if {[dict size $icg_blocks] > 0} {
             ig::log -warn -id "SNGCv" "Module $name: file $path already contains icglue keep blocks... skipping."
             return
         }
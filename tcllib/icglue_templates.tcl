@@ -22,11 +22,26 @@ package provide ICGlue 5.0a1
 ## @brief Template related functionality
 namespace eval ig::templates {
     ## @brief Collect template data
+    #
+    # Each variable is a dict with the template name as key.
     namespace eval collection {
         variable template_dir       {}
         variable template_data_gen  {}
         variable template_args_gen  {}
         variable template_attr_gen {}
+
+        ## @brief Add data of a template to a collection.
+        # @param var Name of collection variable.
+        # @param template Name of template.
+        # @param value Data to add.
+        #
+        # The first definition of a template is kept (order of the template path).
+        proc add {var template value} {
+            variable $var
+            if {![dict exists [set $var] $template]} {
+                dict set $var $template $value
+            }
+        }
     }
 
     ## @brief Callback procs of currently loaded template.
@@ -144,151 +159,7 @@ namespace eval ig::templates {
         # @li signal = Signal this register connects to.
         # @li signalbits = Verilog-range of bits of signal to connect to.
         proc regfile_to_arraylist {regfile_id} {
-            # collect all regfile entries, sort by address
-            set entries [ig::db::get_regfile_entries -all -of $regfile_id]
-            set entry_list {}
-            set wordsize [ig::db::get_attribute -object $regfile_id -attribute "datawidth"]
-
-            foreach i_entry $entries {
-                set reg_list {}
-                set regs [ig::db::get_regfile_regs -all -of $i_entry]
-                set next_bit 0
-
-                try {
-                    #entry_default_map {name width entrybits type reset signal signalbits}
-                    foreach i_reg $regs {
-                        set name       [ig::db::get_attribute -object $i_reg -attribute "name"]
-                        set width      [ig::db::get_attribute -object $i_reg -attribute "rf_width"      -default -1]
-                        set entrybits  [ig::db::get_attribute -object $i_reg -attribute "rf_entrybits"  -default ""]
-                        set type       [ig::db::get_attribute -object $i_reg -attribute "rf_type"       -default "RW"]
-                        set reset      [ig::db::get_attribute -object $i_reg -attribute "rf_reset"      -default "-"]
-                        set signal     [ig::db::get_attribute -object $i_reg -attribute "rf_signal"     -default "-"]
-                        set signalbits [ig::db::get_attribute -object $i_reg -attribute "rf_signalbits" -default "-"]
-                        set comment    [ig::db::get_attribute -object $i_reg -attribute "rf_comment"    -default ""]
-
-                        if {$width < 0} {
-                            if {$entrybits eq ""} {
-                                set width $wordsize
-                                set entrybits "[expr {$wordsize - 1}]:0"
-                            } else {
-                                set blist [split $entrybits ":"]
-                                if {[llength $blist] == 1} {
-                                    set width 1
-                                } else {
-                                    set width [expr {[lindex $blist 0] - [lindex $blist 1] + 1}]
-                                }
-                            }
-                        } elseif {$entrybits eq ""} {
-                            if {$width == 1} {
-                                set entrybits "$next_bit"
-                            } else {
-                                set entrybits "[expr {$width + $next_bit - 1}]:$next_bit"
-                            }
-                        }
-
-                        set blist [split $entrybits ":"]
-                        set bit_high [lindex $blist 0]
-                        set next_bit [expr {$bit_high+1}]
-                        if {[llength $blist] == 2} {
-                            set bit_low  [lindex $blist 1]
-                        } else {
-                            set bit_low  $bit_high
-                        }
-
-                        lappend reg_list [list \
-                            $name $bit_high $bit_low $width $entrybits $type $reset $signal $signalbits $comment $i_reg \
-                            ]
-                    }
-                    set reg_list_raw [lsort -integer -index 2 $reg_list]
-                    set reg_list {}
-                    set idx_start -1
-
-                    foreach i_reg $reg_list_raw {
-                        set i_bit_low [lindex $i_reg 2]
-                        set i_bit_high [lindex $i_reg 1]
-                        if {$i_bit_low - $idx_start > 1} {
-                            set tmp_high [expr {$i_bit_low - 1}]
-                            set tmp_low  [expr {$idx_start + 1}]
-                            if {$tmp_high == $tmp_low} {
-                                set entrybits $tmp_high
-                            } else {
-                                set entrybits "${tmp_high}:${tmp_low}"
-                            }
-
-                            lappend reg_list [list \
-                                "name"       "-" \
-                                "bit_high"   $tmp_high \
-                                "bit_low"    $tmp_low \
-                                "width"      [expr {$tmp_high - $tmp_low + 1}] \
-                                "entrybits"  $entrybits \
-                                "type"       "-" \
-                                "reset"      "-" \
-                                "signal"     "-" \
-                                "signalbits" "-" \
-                                "comment"    "" \
-                                "object"     "" \
-                                ]
-                        }
-                        lappend reg_list [list \
-                            "name"       [lindex $i_reg 0] \
-                            "bit_high"   [lindex $i_reg 1] \
-                            "bit_low"    [lindex $i_reg 2] \
-                            "width"      [lindex $i_reg 3] \
-                            "entrybits"  [lindex $i_reg 4] \
-                            "type"       [lindex $i_reg 5] \
-                            "reset"      [lindex $i_reg 6] \
-                            "signal"     [lindex $i_reg 7] \
-                            "signalbits" [lindex $i_reg 8] \
-                            "comment"    [lindex $i_reg 9] \
-                            "object"     [lindex $i_reg 10] \
-                            ]
-
-                        set idx_start $i_bit_high
-                    }
-                    if {$idx_start < $wordsize - 1} {
-                        set tmp_high [expr {$wordsize - 1}]
-                        set tmp_low  [expr {$idx_start + 1}]
-                        if {$tmp_high == $tmp_low} {
-                            set entrybits $tmp_high
-                        } else {
-                            set entrybits "${tmp_high}:${tmp_low}"
-                        }
-
-                        lappend reg_list [list \
-                            "name"       "-" \
-                            "bit_high"   $tmp_high \
-                            "bit_low"    $tmp_low \
-                            "width"      [expr {$tmp_high - $tmp_low + 1}] \
-                            "entrybits"  $entrybits \
-                            "type"       "-" \
-                            "reset"      "-" \
-                            "signal"     "-" \
-                            "signalbits" "-" \
-                            "comment"    "" \
-                            "object"     "" \
-                            ]
-                    }
-
-                    set entry_attributes [ig::db::get_attribute -object $i_entry]
-                    lappend entry_list [list                                                    \
-                        "address" [ig::db::get_attribute -object $i_entry -attribute "address"] \
-                        "comment" [ig::db::get_attribute -object $i_entry -attribute "comment"] \
-                        {*}[dict remove $entry_attributes "address"]                            \
-                        "regs"    $reg_list                                                     \
-                        "object"  $i_entry                                                      \
-                        ]
-                } on error {emsg eopt} {
-                    ig::log -error -id RF [format "Error while processing register \"%s/%s\" in regfile \"%s\" \n -- (%s) --\n%s" \
-                        [ig::db::get_attribute -object ${i_entry} -attribute "name"] ${name} \
-                        [ig::db::get_attribute -object ${regfile_id} -attribute "name"] \
-                        ${i_entry} \
-                        [dict get $eopt {-errorinfo}]
-                    ]
-                }
-            }
-            set entry_list [lsort -integer -index 1 $entry_list]
-
-            return $entry_list
+            return [ig::db::get_regfile_arraylist -of $regfile_id]
         }
 
         ## @brief Preprocess instance-object into array-list.
@@ -329,24 +200,33 @@ namespace eval ig::templates {
 
             # pins
             set pin_data {}
-            foreach i_pin [ig::db::get_pins -of $instance_id] {
+            set pins [ig::db::get_pins -of $instance_id]
+            foreach i_pin $pins {name connection_raw invert adapt} [ig::db::get_attributes_bulk -objects $pins \
+                    -attributes {"name" "connection" {"invert" "false"} {"adapt" "none"}}] {
+                # unadapted connections need no replacement map
+                if {$adapt eq "none"} {
+                    set connection $connection_raw
+                } else {
+                    set connection [ig::aux::adapt_pin_connection $i_pin]
+                }
                 lappend pin_data [list \
-                    "name"           [ig::db::get_attribute -object $i_pin -attribute "name"] \
+                    "name"           $name \
                     "object"         $i_pin \
-                    "connection"     [ig::aux::adapt_pin_connection $i_pin] \
-                    "connection_raw" [ig::db::get_attribute -object $i_pin -attribute "connection"] \
-                    "invert"         [ig::db::get_attribute -object $i_pin -attribute "invert" -default "false"] \
+                    "connection"     $connection \
+                    "connection_raw" $connection_raw \
+                    "invert"         $invert \
                 ]
             }
             lappend result "pins" $pin_data
 
             # parameters
             set param_data {}
-            foreach i_param [ig::db::get_adjustments -of $instance_id] {
+            set params [ig::db::get_adjustments -of $instance_id]
+            foreach i_param $params {name value} [ig::db::get_attributes_bulk -objects $params -attributes {"name" "value"}] {
                 lappend param_data [list \
-                    "name"           [ig::db::get_attribute -object $i_param -attribute "name"] \
+                    "name"           $name \
                     "object"         $i_param \
-                    "value"          [ig::db::get_attribute -object $i_param -attribute "value"] \
+                    "value"          $value \
                 ]
             }
             lappend result "parameters" $param_data
@@ -419,19 +299,20 @@ namespace eval ig::templates {
             set lang [ig::db::get_attribute -object $module_id -attribute "language"]
             # ports
             set port_data {}
-            foreach i_port [ig::db::get_ports -of $module_id] {
+            set ports [ig::db::get_ports -of $module_id]
+            foreach i_port $ports {name size direction dimensions signed} [ig::db::get_attributes_bulk -objects $ports \
+                    -attributes {"name" "size" "direction" {"dimension" {}} {"signed" false}}] {
                 set dimension_bitrange {}
-                foreach dimension [ig::db::get_attribute -object $i_port -attribute "dimension" -default {}] {
+                foreach dimension $dimensions {
                     append dimension_bitrange [ig::vlog::bitrange $dimension]
                 }
-                set signed [ig::db::get_attribute -object $i_port -attribute "signed" -default false]
                 set vsigned [expr {$signed ? "signed" : {}}]
                 lappend port_data [list \
-                    "name"           [ig::db::get_attribute -object $i_port -attribute "name"] \
+                    "name"           $name \
                     "object"         $i_port \
-                    "size"           [ig::db::get_attribute -object $i_port -attribute "size"] \
-                    "vlog.bitrange"  [ig::vlog::obj_bitrange $i_port] \
-                    "direction"      [ig::db::get_attribute -object $i_port -attribute "direction"] \
+                    "size"           $size \
+                    "vlog.bitrange"  [ig::vlog::bitrange $size] \
+                    "direction"      $direction \
                     "vlog.direction" "[concat [ig::vlog::port_dir $i_port] $vsigned]" \
                     "dimension"      $dimension_bitrange \
                     "signed"         $signed \
@@ -441,30 +322,29 @@ namespace eval ig::templates {
 
             # parameters
             set param_data {}
-            foreach i_param [ig::db::get_parameters -of $module_id] {
+            set params [ig::db::get_parameters -of $module_id]
+            foreach i_param $params {name local value} [ig::db::get_attributes_bulk -objects $params -attributes {"name" "local" "value"}] {
                 lappend param_data [list \
-                    "name"           [ig::db::get_attribute -object $i_param -attribute "name"] \
+                    "name"           $name \
                     "object"         $i_param \
-                    "local"          [ig::db::get_attribute -object $i_param -attribute "local"] \
+                    "local"          $local \
                     "vlog.type"      [ig::vlog::param_type $i_param] \
-                    "value"          [ig::db::get_attribute -object $i_param -attribute "value"] \
+                    "value"          $value \
                 ]
             }
             lappend result "parameters" $param_data
 
             # delarations
             set decl_data {}
-            foreach i_decl [ig::db::get_declarations -of $module_id] {
+            set decls [ig::db::get_declarations -of $module_id]
+            foreach i_decl $decls {name type size dimensions signed} [ig::db::get_attributes_bulk -objects $decls \
+                    -attributes {"name" "nettype" "size" {"dimension" {}} {"signed" false}}] {
                 set dimension_bitrange {}
-                foreach dimension [ig::db::get_attribute -object $i_decl -attribute "dimension" -default {}] {
+                foreach dimension $dimensions {
                     append dimension_bitrange [ig::vlog::bitrange $dimension]
                 }
-                set signed [ig::db::get_attribute -object $i_decl -attribute "signed" -default false]
                 set vsigned [expr {$signed ? "signed" : {}}]
 
-                set name [ig::db::get_attribute -object $i_decl -attribute "name"]
-                set type [ig::db::get_attribute -object $i_decl -attribute "nettype"]
-
                 # TODO: workaround - keep uppercase names as wire --> might be analog or inout
                 if {[string toupper $name] eq $name} {
                     set vlog_type "wire"
@@ -479,8 +359,8 @@ namespace eval ig::templates {
                 lappend decl_data [list \
                     "name"           $name \
                     "object"         $i_decl \
-                    "size"           [ig::db::get_attribute -object $i_decl -attribute "size"] \
-                    "vlog.bitrange"  [ig::vlog::obj_bitrange $i_decl] \
+                    "size"           $size \
+                    "vlog.bitrange"  [ig::vlog::bitrange $size] \
                     "vlog.type"      "[concat $vlog_type $vsigned]" \
                     "dimension"      $dimension_bitrange \
                     "signed"         $signed \
@@ -490,11 +370,12 @@ namespace eval ig::templates {
 
             # codesections
             set code_data {}
-            foreach i_code [ig::db::get_codesections -of $module_id] {
+            set codesections [ig::db::get_codesections -of $module_id]
+            foreach i_code $codesections {name code_raw} [ig::db::get_attributes_bulk -objects $codesections -attributes {"name" "code"}] {
                 lappend code_data [list \
-                    "name"           [ig::db::get_attribute -object $i_code -attribute "name"] \
+                    "name"           $name \
                     "object"         $i_code \
-                    "code_raw"       [ig::db::get_attribute -object $i_code -attribute "code"] \
+                    "code_raw"       $code_raw \
                     "code"           [ig::aux::adapt_codesection $i_code] \
                 ]
             }
@@ -510,13 +391,15 @@ namespace eval ig::templates {
 
             # regfiles
             set regfile_data {}
-            foreach i_regfile [ig::db::get_regfiles -of $module_id] {
+            set regfiles [ig::db::get_regfiles -of $module_id]
+            foreach i_regfile $regfiles {name addrwidth addralign datawidth} [ig::db::get_attributes_bulk -objects $regfiles \
+                    -attributes {"name" "addrwidth" "addralign" "datawidth"}] {
                 lappend regfile_data [list \
-                    "name"      [ig::db::get_attribute -object $i_regfile -attribute "name"] \
-                    "addrwidth" [ig::db::get_attribute -object $i_regfile -attribute "addrwidth"] \
-                    "addralign" [ig::db::get_attribute -object $i_regfile -attribute "addralign"] \
-                    "datawidth" [ig::db::get_attribute -object $i_regfile -attribute "datawidth"] \
-                    "name"      [ig::db::get_attribute -object $i_regfile -attribute "name"] \
+                    "name"      $name \
+                    "addrwidth" $addrwidth \
+                    "addralign" $addralign \
+                    "datawidth" $datawidth \
+                    "name"      $name \
                     "object"    $i_regfile \
                     "entries"   [regfile_to_arraylist $i_regfile] \
                 ]
@@ -554,9 +437,7 @@ namespace eval ig::templates {
             set template     [file tail [file normalize [file dirname $initf_name]]]
             set template_dir [file normalize "${dir}/${template}"]
 
-            lappend ig::templates::collection::template_dir [list \
-                $template $template_dir \
-            ]
+            ig::templates::collection::add template_dir $template $template_dir
 
             set preface {
                 # icglue 2/3 init compatibility:
@@ -585,7 +466,7 @@ namespace eval ig::templates {
                         if {$bc_types eq {}} {return}
                         if {$bc_tfile eq {}} {return}
                         if {$bc_ofile eq {}} {return}
-                        if {[lsearch -index 0 $ig::templates::collection::template_data_gen $template] >= 0} {return}
+                        if {[dict exists $ig::templates::collection::template_data_gen $template]} {return}
 
                         set body_pre [subst {
                             set bc_types [list $bc_types]
@@ -604,9 +485,7 @@ namespace eval ig::templates {
                                 add $type $tlang $tpath $opath
                             }
                         }
-                        lappend ig::templates::collection::template_data_gen [list \
-                            $template ${body_pre}${body} \
-                        ]
+                        ig::templates::collection::add template_data_gen $template ${body_pre}${body}
                     }
                 }
 
@@ -618,27 +497,21 @@ namespace eval ig::templates {
                             if {$arglist ne {userdata tdir}} {
                                 ig::log -error "template ${template}: invalid template_data definition (arguments must be {userdata tdir})"
                             } else {
-                                lappend ig::templates::collection::template_data_gen [list \
-                                    $template $body \
-                                ]
+                                ig::templates::collection::add template_data_gen $template $body
                             }
                         }
                         template_args {
                             if {$arglist ne {}} {
                                 ig::log -error "template ${template}: invalid template_args definition (arguments must be {})"
                             } else {
-                                lappend ig::templates::collection::template_args_gen [list \
-                                    $template $body \
-                                ]
+                                ig::templates::collection::add template_args_gen $template $body
                             }
                         }
                         template_attributes {
                             if {$arglist ne {userdata}} {
                                 ig::log -error "template ${template}: invalid template_args definition (arguments must be {})"
                             } else {
-                                lappend ig::templates::collection::template_attr_gen [list \
-                                    $template $body \
-                                ]
+                                ig::templates::collection::add template_attr_gen $template $body
                             }
                         }
 
@@ -679,25 +552,20 @@ namespace eval ig::templates {
     # template directory using @ref add_template_dir.
     proc load_template {template} {
         # load vars/procs for current template
-        set dir_idx   [lsearch -index 0 $collection::template_dir      $template]
-        set data_idx  [lsearch -index 0 $collection::template_data_gen $template]
-        set args_idx  [lsearch -index 0 $collection::template_args_gen $template]
-        set props_idx [lsearch -index 0 $collection::template_attr_gen $template]
-
-        if {($dir_idx < 0) || ($data_idx < 0)} {
+        if {![dict exists $collection::template_dir $template] || ![dict exists $collection::template_data_gen $template]} {
             ig::log -error -abort "template $template not (fully) defined"
         }
 
-        set current::template_dir [lindex $collection::template_dir $dir_idx 1]
+        set current::template_dir [dict get $collection::template_dir $template]
         # workaround for doxygen: is otherwise irritated by directly visible proc keyword
         set procdef "proc"
-        if {$args_idx < 0} {
+        if {![dict exists $collection::template_args_gen $template]} {
             $procdef current::template_args {} {return {}}
         } else {
-            $procdef current::template_args {} [lindex $collection::template_args_gen $args_idx 1]
+            $procdef current::template_args {} [dict get $collection::template_args_gen $template]
         }
-        $procdef current::get_template_data_raw {userdata tdir} [lindex $collection::template_data_gen $data_idx 1]
-        if {$props_idx < 0} {
+        $procdef current::get_template_data_raw {userdata tdir} [dict get $collection::template_data_gen $template]
+        if {![dict exists $collection::template_attr_gen $template]} {
             # icglue 4 backwards compatibility: directly forward all attributes
             $procdef current::template_attr {userdata} {
                 set object [dict get $userdata "object"]
@@ -708,7 +576,7 @@ namespace eval ig::templates {
                 }
             }
         } else {
-            $procdef current::template_attr {userdata} [lindex $collection::template_attr_gen $props_idx 1]
+            $procdef current::template_attr {userdata} [dict get $collection::template_attr_gen $template]
         }
     }
 
@@ -723,120 +591,30 @@ namespace eval ig::templates {
     # The resulting Tcl Code will write the generated output
     # using the command @c echo, which needs to be provided,
     # when evaluating.
+    #
+    # Lexing is done by @ref ig::util::template_lex_icgt, includes are read by @ref parse_template_include.
     proc parse_template {txt {filename {}}} {
-        set code  {}
-        set stack [list [list $filename 1 $txt]]
-
-        while {[llength $stack] > 0} {
-            lassign [lindex $stack end] filename linenr txt
-            set stack [lreplace $stack end end]
-
-            append code "_filename [list $filename]\n"
-            append code "_linenr $linenr\n"
-
-            set re_delim_open     {<(%|\[)([+-])?}
-            set delim_close       "%>"
-            set delim_close_brack "\]>"
-
-            # search  delimiter
-            while {[regexp -indices $re_delim_open $txt indices m_type m_chomp]} {
-                lassign $indices i_delim_start i_delim_end
-
-                # include tag
-                set incltag 0
-
-                set opening_char [string index $txt [lindex $m_type 0]]
-                if {$opening_char eq "%"} {
-                    set closing_delim $delim_close
-                } else {
-                    set closing_delim $delim_close_brack
-                }
-
-                # check for right chomp
-                set right_i [expr {$i_delim_start - 1}]
-
-
-                set i [expr {$i_delim_end + 1}]
-                if {([string index $txt [lindex $m_chomp 0]] eq "-") && ([string index $txt $right_i] eq "\n")} {
-                    incr right_i -1
-                }
-
-                # append verbatim/normal template content (tcl-list)
-                incr linenr [ig::aux::string_count_nl [string range $txt 0 [expr {$i-1}]]]
-                append code "_linenr $linenr\n"
-                append code "echo [list [string range $txt 0 $right_i]]\n"
-                set txt [string range $txt $i end]
-
-                if {$closing_delim eq "%>"} {
-                    if {[string index $txt 0] eq "="} {
-                    # <%= will be be append, but evaluated as tcl-argument
-                        append code "echo "
-                        set txt [string range $txt 1 end]
-                    } elseif {[string index $txt 0] eq "I"} {
-                    # <%I will be included here
-                        set incltag 1
-                        set txt [string range $txt 1 end]
-                    } else {
-                    # append as tcl code
-                    }
-                } else {
-                    # closing delimiter is closing square bracket
-                    append code "echo \[ "
-                }
-
-                # search ${closing_delim} delimiter
-                if {[set i [string first $closing_delim $txt]] == -1} {
-                    error "No matching $closing_delim"
-                }
-                set left_i [expr {$i + 2}]
-                incr i -1
-                # check for left chomp
-                if {[string match {[-+]} [string index $txt $i]]} {
-                    if {([string index $txt $i] eq "-") && ([string index $txt $left_i] eq "\n")} {
-                        incr left_i
-                    }
-                    incr i -1
-                }
-
-                # include tag / code
-                incr linenr [ig::aux::string_count_nl [string range $txt 0 [expr {$left_i-1}]]]
-
-                if {$incltag} {
-                    set incfname [file join ${current::template_dir} [string trim [string range $txt 0 $i]]]
-                    ig::log -info -id TPrs "...parsing included template $incfname"
-                    set incfile [open $incfname "r"]
-                    set inccontent [read $incfile]
-                    close $incfile
-
-                    lappend stack [list $filename $linenr [string range $txt $left_i end]]
-                    set linenr 1
-                    set filename $incfname
-                    set txt $inccontent
-
-                    # loop-check
-                    if {[lsearch -index 0 $stack $filename] >= 0} {
-                        error "template file $filename includes itself"
-                    }
-                } else {
-                    if {$closing_delim eq "%>"} {
-                        append code "[string range $txt 0 $i] \n"
-                    } else {
-                        # closing delimiter is closing square bracket
-                        append code "[string range $txt 0 $i] \]\n"
-                    }
-                    set txt [string range $txt $left_i end]
-                }
-                append code "_filename [list $filename]\n"
-                append code "_linenr $linenr\n"
-            }
+        return [ig::util::template_lex_icgt -text $txt -filename $filename -includecmd [list ::ig::templates::parse_template_include]]
+    }
 
-            # append remainder of verbatim/normal template content
-            if {$txt ne ""} {
-                append code "echo [list $txt]\n"
-            }
+    ## @brief Read template included by an include tag (callback of @ref parse_template).
+    # @param spec Content of include tag (file relative to template directory).
+    # @param files Template files currently parsed.
+    # @return List of included file name and its content.
+    proc parse_template_include {spec files} {
+        set incfname [file join ${current::template_dir} [string trim $spec]]
+        ig::log -info -id TPrs "...parsing included template $incfname"
+        lappend ::ig::templates::template_includes $incfname
+        set incfile [open $incfname "r"]
+        set inccontent [read $incfile]
+        close $incfile
+
+        # loop-check
+        if {[lsearch $files $incfname] >= 0} {
+            error "template file $incfname includes itself"
         }
 
-        return $code
+        return [list $incfname $inccontent]
     }
 
     ## @brief Parse a Woof!-like template.
@@ -853,158 +631,90 @@ namespace eval ig::templates {
     # The resulting Tcl Code will write the generated output
     # using the command @c echo, which needs to be provided,
     # when evaluating.
+    #
+    # Lexing is done by @ref ig::util::template_lex_wtf, include and substitute mode lines
+    # are processed by @ref parse_wtf_directive.
     proc parse_wtf {txt {filename {}} {filestack {}}} {
-        set code {}
-
-        set pos 0
-        set block false
-        set linenr 1
-
-        set substmode {}
-
-        lappend filestack $filename
-
-        append code "_filename [list $filename]\n"
-        append code "_linenr $linenr\n"
-
-        # find all lines starting with %
-        foreach pair [regexp -line -all -inline -indices -- {^%.*$} $txt] {
-            lassign $pair from to
-
-            if {$block} {
-                # inside %( ... %)
-                if {[string range $txt $from [expr {$from+1}]] eq "%)"} {
-                    # block ends
-                    if {[string range $txt [expr {$from+2}] $to] ne ""} {
-                        ig::log -warn -id "WTFPr" "template $filename contains text after \"%)\""
-                    }
-
-                    set c [string range $txt $pos [expr {$from-2}]]
-                    append code $c "\n"
-                    incr linenr [expr {[ig::aux::string_count_nl $c] + 1}]
-
-                    set block false
-                    set pos   [expr {$to + 2}]
-                } else {
-                    # ignore
-                    continue
-                }
-            } else {
-                # single codeline / begin of %( ... %)
-
-                # raw text so far
-                set s [string range $txt $pos [expr {$from-1}]]
-
-                if {$s ne {}} {
-                    append code "_linenr $linenr\n"
-                    append code "echo \"\[" [list subst {*}$substmode $s] "\]\"\n"
-                    incr linenr [expr {[ig::aux::string_count_nl $s]}]
-                    append code "_linenr $linenr\n"
-                }
-
-                if {[string range $txt $from [expr {$from+2}]] eq "%I("} {
-                    # include file
-                    set s [string range $txt $from $to]
-                    if {![regexp {^%I\([\s]*(.*[^\s])[\s]*\)[\s]*([^\s].*)?$} $s m_whole m_file m_sfx]} {
-                        ig::log -error -abort -id "WTFPr" "template $filename (line $linenr) contains invalid include statement"
-                    }
-                    if {$m_sfx ne ""} {
-                        ig::log -warn -id "WTFPr" "template $filename (line $linenr) contains text after include statement"
-                    }
-
-                    set incfname [file join ${current::template_dir} $m_file]
-
-                    # loop-check
-                    if {[lsearch $filestack $incfname] >= 0} {
-                        ig::log -error -abort -id "WTFPr" "template file $filename (line $linenr) includes itself"
-                    }
-
-                    ig::log -info -id WTFPr "...parsing included template $incfname"
-                    set incfile [open $incfname "r"]
-                    set inccontent [read $incfile]
-                    close $incfile
-
-                    append code [parse_wtf $inccontent $incfname $filestack] "\n"
-
-                    incr linenr
+        return [ig::util::template_lex_wtf -text $txt -filename $filename -filestack $filestack -directivecmd [list ::ig::templates::parse_wtf_directive]]
+    }
 
-                    append code "_filename [list $filename]\n"
-                    append code "_linenr $linenr\n"
+    ## @brief Process include or substitute mode line of a Woof!-like template (callback of @ref parse_wtf).
+    # @param s Template line starting with "%I(" or "%M(".
+    # @param filename Name of template file for error logging.
+    # @param linenr Line number of template line.
+    # @param filestack List of files included to check for recursion loops (including current file).
+    # @param substmode Current substitute mode switches.
+    # @return List of Tcl-Code generated from included template and new substitute mode switches.
+    proc parse_wtf_directive {s filename linenr filestack substmode} {
+        if {[string range $s 0 2] eq "%I("} {
+            # include file
+            if {![regexp {^%I\([\s]*(.*[^\s])[\s]*\)[\s]*([^\s].*)?$} $s m_whole m_file m_sfx]} {
+                ig::log -error -abort -id "WTFPr" "template $filename (line $linenr) contains invalid include statement"
+            }
+            if {$m_sfx ne ""} {
+                ig::log -warn -id "WTFPr" "template $filename (line $linenr) contains text after include statement"
+            }
 
-                    set pos [expr {$to + 2}]
-                } elseif {[string range $txt $from [expr {$from+2}]] eq "%M("} {
-                    # subst mode
-                    set s [string range $txt $from $to]
-                    if {![regexp {^%M\((.*)\)[\s]*([^\s].*)?$} $s m_whole m_modes m_sfx]} {
-                        ig::log -error -abort -id "WTFPr" "template $filename (line $linenr) contains invalid substitute mode statement"
-                    }
-                    if {$m_sfx ne ""} {
-                        ig::log -warn -id "WTFPr" "template $filename (line $linenr) contains text after substitute mode statement"
-                    }
+            set incfname [file join ${current::template_dir} $m_file]
 
-                    set str_nbs  "-nobackslashes"
-                    set str_ncmd "-nocommands"
-                    set str_nvar "-novariables"
+            # loop-check
+            if {[lsearch $filestack $incfname] >= 0} {
+                ig::log -error -abort -id "WTFPr" "template file $filename (line $linenr) includes itself"
+            }
 
-                    set bs  [expr {$str_nbs  ni $substmode}]
-                    set cmd [expr {$str_ncmd ni $substmode}]
-                    set var [expr {$str_nvar ni $substmode}]
+            ig::log -info -id WTFPr "...parsing included template $incfname"
+            lappend ::ig::templates::template_includes $incfname
+            set incfile [open $incfname "r"]
+            set inccontent [read $incfile]
+            close $incfile
 
-                    foreach mode [split $m_modes] {
-                        if {![regexp {^([-+^!~]?)(\$|\[\]|\\)$} $mode m_whole m_pfx m_mode]} {
-                            ig::log -error -abort -id "WTFPr" "template $filename (line $linenr) contains invalid substitute mode statement \"$mode\""
-                        }
-                        if {$m_pfx in {+ {}}} {
-                            set res true
-                        } else {
-                            set res false
-                        }
-                        if {$m_mode eq {$}} {
-                            set var $res
-                        } elseif {$m_mode eq {[]}} {
-                            set cmd $res
-                        } elseif {$m_mode eq "\\"} {
-                            set bs $res
-                        } else {
-                            ig::log -error -abort -id "WTFPr" "template $filename (line $linenr) contains invalid substitute mode statement"
-                        }
-                    }
+            return [list [parse_wtf $inccontent $incfname $filestack] $substmode]
+        }
 
-                    set substmode {}
-                    if {!$bs}  {lappend substmode $str_nbs}
-                    if {!$cmd} {lappend substmode $str_ncmd}
-                    if {!$var} {lappend substmode $str_nvar}
+        # subst mode
+        if {![regexp {^%M\((.*)\)[\s]*([^\s].*)?$} $s m_whole m_modes m_sfx]} {
+            ig::log -error -abort -id "WTFPr" "template $filename (line $linenr) contains invalid substitute mode statement"
+        }
+        if {$m_sfx ne ""} {
+            ig::log -warn -id "WTFPr" "template $filename (line $linenr) contains text after substitute mode statement"
+        }
 
-                    puts "new subst switches: $substmode"
+        set str_nbs  "-nobackslashes"
+        set str_ncmd "-nocommands"
+        set str_nvar "-novariables"
 
-                    incr linenr
-                    set pos [expr {$to + 2}]
-                } elseif {[string range $txt $from [expr {$from+1}]] eq "%("} {
-                    # beginning of block
-                    set pos [expr {$from + 2}]
-                    set block true
-                    incr linenr
-                } else {
-                    # single line
-                    append code [string range $txt [expr {$from+1}] $to] "\n"
+        set bs  [expr {$str_nbs  ni $substmode}]
+        set cmd [expr {$str_ncmd ni $substmode}]
+        set var [expr {$str_nvar ni $substmode}]
 
-                    set pos [expr {$to + 2}]
-                    incr linenr
-                }
+        foreach mode [split $m_modes] {
+            if {![regexp {^([-+^!~]?)(\$|\[\]|\\)$} $mode m_whole m_pfx m_mode]} {
+                ig::log -error -abort -id "WTFPr" "template $filename (line $linenr) contains invalid substitute mode statement \"$mode\""
+            }
+            if {$m_pfx in {+ {}}} {
+                set res true
+            } else {
+                set res false
+            }
+            if {$m_mode eq {$}} {
+                set var $res
+            } elseif {$m_mode eq {[]}} {
+                set cmd $res
+            } elseif {$m_mode eq "\\"} {
+                set bs $res
+            } else {
+                ig::log -error -abort -id "WTFPr" "template $filename (line $linenr) contains invalid substitute mode statement"
             }
         }
 
-        if {$block} {
-            error "No matching %)"
-        }
+        set substmode {}
+        if {!$bs}  {lappend substmode $str_nbs}
+        if {!$cmd} {lappend substmode $str_ncmd}
+        if {!$var} {lappend substmode $str_nvar}
 
-        set s [string range $txt $pos end]
-        if {$s ne {}} {
-            append code "_linenr $linenr\n"
-            append code "echo \"\[" [list subst {*}$substmode $s] "\]\"\n"
-        }
+        puts "new subst switches: $substmode"
 
-        return $code
+        return [list {} $substmode]
     }
 
     ## @brief Return comment begin/end for given filetype
@@ -1041,7 +751,8 @@ namespace eval ig::templates {
     ## @brief Parse keep blocks of an existing output (file).
     # @param txt Existing generated output as single String.
     # @param lexcom lexer token for comment as list - e.g {"/* " " */"}
-    # @return List of parsed blocks as sublists of form {\<maintype\> \<subtype\> \<content\>}.
+    # @return dict with keys of form {\<maintype\> \<subtype\>} and a list of parsed blocks
+    #   of this type as value, each block as list {\<index\> \<content\>}.
     #
     # The blocks parsed are of the form @code{.v}
     # /* icglue <maintype> begin <subtype> */
@@ -1050,38 +761,10 @@ namespace eval ig::templates {
     #
     # Currently only @c keep is supported as maintype.
     # Subtypes depend on the template used.
+    # Repeated blocks of the same type are kept in the order of their occurrence,
+    # see @ref ig::util::extract_keep_blocks.
     proc parse_keep_blocks {txt lexcom} {
-        set result [list]
-        lassign $lexcom cbegin cend
-
-        # compatibility: accept comments with "pragma"
-        if {[string first "${cbegin}pragma icglue keep begin " $txt] >= 0} {
-            set block_start "${cbegin}pragma icglue keep begin "
-            set block_end   "${cbegin}pragma icglue keep end${cend}"
-        } else {
-            set block_start "${cbegin}icglue keep begin "
-            set block_end   "${cbegin}icglue keep end${cend}"
-        }
-
-        while {[set i [string first $block_start $txt]] >= 0} {
-            incr i [string length $block_start]
-
-            if {[set j [string first $cend $txt $i]] < 0} {
-                error "No end of icglue keep comment"
-            }
-
-            set type [string range $txt $i [expr {$j - 1}]]
-            set txt [string range $txt [expr {$j + [string length $cend]}] end]
-
-            if {[set i [string first $block_end $txt]] < 0} {
-                error "No end of block after keep block begin - pragma type was ${type}"
-            }
-            set value [string range $txt 0 [expr {$i-1}]]
-            set txt [string range $txt [expr {$i + [string length $block_end]}] end]
-
-            lappend result [list "keep" $type $value]
-        }
-        return $result
+        return [ig::util::extract_keep_blocks -text $txt -lexcom $lexcom]
     }
 
     ## @brief Format given content of keep block for specified filetype (internal use only!).
@@ -1127,9 +810,9 @@ namespace eval ig::templates {
     # @return Content of specified block previously parsed or default_content.
     proc get_keep_block_content {block_data block_entry block_subentry {filesuffix ""} {default_content {}}} {
         upvar lexcom lexcom
-        set idx [lsearch -index 1 [lsearch -inline -all -index 0 $block_data $block_entry] $block_subentry]
-        if {$idx >= 0} {
-            return [format_keep_block_content $block_entry $block_subentry [lindex $block_data $idx 2] $filesuffix]
+        set key [list $block_entry $block_subentry]
+        if {[dict exists $block_data $key]} {
+            return [format_keep_block_content $block_entry $block_subentry [lindex [dict get $block_data $key] 0 1] $filesuffix]
         } else {
             return [format_keep_block_content $block_entry $block_subentry $default_content $filesuffix]
         }
@@ -1143,16 +826,22 @@ namespace eval ig::templates {
     # @param default_content Default block content if nothing has been parsed
     # @return Content of specified block previously parsed or default_content.
     #
-    # The returned block will be removed from the list in block_data_var.
+    # The returned block will be removed from the list in block_data_var,
+    # so a repeated block of the same type returns the next parsed block.
     proc pop_keep_block_content {block_data_var block_entry block_subentry {filesuffix ""} {default_content {}}} {
         upvar $block_data_var block_data lexcom lexcom
 
         # TODO: allow multi comment mode (calling parse template from here)
-        set idx [lsearch -index 1 [lsearch -inline -all -index 0 $block_data $block_entry] $block_subentry]
+        set key [list $block_entry $block_subentry]
 
-        if {$idx >= 0} {
-            set result [format_keep_block_content $block_entry $block_subentry [lindex $block_data $idx 2] $filesuffix]
-            set block_data [lreplace $block_data $idx $idx]
+        if {[dict exists $block_data $key]} {
+            set blocks [dict get $block_data $key]
+            set result [format_keep_block_content $block_entry $block_subentry [lindex $blocks 0 1] $filesuffix]
+            if {[llength $blocks] > 1} {
+                dict set block_data $key [lrange $blocks 1 end]
+            } else {
+                dict unset block_data $key
+            }
             return $result
         } else {
             return [format_keep_block_content $block_entry $block_subentry $default_content $filesuffix]
@@ -1165,10 +854,17 @@ namespace eval ig::templates {
     # @param nonempty Only return non-empty keep blocks.
     # @return list of all generated keep block comments.
     proc remaining_keep_block_contents {block_data {filesuffix ""} {nonempty "true"}} {
-        set result [list]
+        set blocks [list]
+        dict for {key key_blocks} $block_data {
+            foreach i_block $key_blocks {
+                lappend blocks [list {*}$i_block {*}$key]
+            }
+        }
 
-        foreach i_block $block_data {
-            lassign $i_block block_entry block_subentry content
+        # output in order of occurrence
+        set result [list]
+        foreach i_block [lsort -integer -index 0 $blocks] {
+            lassign $i_block idx content block_entry block_subentry
 
             if {$nonempty && ($content eq {})} {continue}
 
@@ -1178,40 +874,745 @@ namespace eval ig::templates {
         return $result
     }
 
-    # template parse cache
-    variable template_script_cache [list]
+    # template parse cache: normalized template file -> template script
+    variable template_script_cache [dict create]
+    # template timing statistics: template file -> {parse <us> runs <n> first <us> total <us>}
+    variable template_stats [dict create]
+    # output statistics: number of output files written / left unchanged
+    variable output_stats [dict create "written" 0 "unchanged" 0]
+    # do not rewrite output files with unchanged content
+    variable output_skip_unchanged "false"
+    # skip generation of outputs with unchanged inputs according to output manifests
+    variable output_incremental "false"
+    # output manifests loaded so far: directory -> dict of file -> {input-hash output-hash}
+    variable output_manifests [dict create]
+    # output manifest entries updated in this run: directory -> dict of file -> {input-hash output-hash}
+    variable output_manifest_updates [dict create]
+    # template fingerprints: normalized template file -> hash
+    variable template_fingerprints [dict create]
+    # files included by the template currently parsed
+    variable template_includes {}
+    # directory of persistent template script cache or empty if disabled
+    variable template_cache_dir {}
+    # parser identification for persistent cache: cache entries of other versions are ignored
+    # (package version, parser tcl code, native lexer version and shared library)
+    variable template_cache_parser [list \
+        [package provide ICGlue] \
+        [expr {[catch {file mtime [info script]} mtime] ? 0 : $mtime}] \
+        [ig::util::template_lexer_version] \
+        [apply {{} {
+            foreach {lib_file lib_pkg} [join [info loaded]] {
+                if {[string equal -nocase $lib_pkg "icglue"]} {
+                    if {![catch {file mtime $lib_file} mtime]} {
+                        return [list [file tail $lib_file] $mtime [file size $lib_file]]
+                    }
+                }
+            }
+            return {}
+        }}] \
+    ]
 
     ## @brief Lookup template file in cache and returned cached template script or parse @c template_filename.
     # @param template_filename Path to file to lookup.
     # @param template_lang Template Language
     # @return cached or parsed template file script.
+    #
+    # If a persistent cache directory is set (see @ref set_template_cache_dir),
+    # parsed scripts are read from/written to it.
     proc get_template_script {template_filename {template_lang "icgt"}} {
         variable template_script_cache
+        variable template_includes
 
         set fname_full [file normalize $template_filename]
 
-        set idx [lsearch -index 0 $template_script_cache $fname_full]
-        if {$idx >= 0} {
-            return [lindex $template_script_cache $idx 1]
+        if {[dict exists $template_script_cache $fname_full]} {
+            return [dict get $template_script_cache $fname_full]
         }
 
+        set t_start [clock microseconds]
+
         set template_file [open ${template_filename} "r"]
         set template_raw [read ${template_file}]
         close ${template_file}
 
-        if {($template_lang eq "icgt") || ($template_lang eq {})} {
-            set template_script [parse_template ${template_raw} ${template_filename}]
-        } elseif {($template_lang eq "wtf")} {
-            set template_script [parse_wtf ${template_raw} ${template_filename}]
-        } else {
-            ig::log -error -abort "invalid template language ${template_lang}"
+        set template_script [template_cache_read $fname_full $template_lang $template_raw]
+
+        if {$template_script eq {}} {
+            set template_includes {}
+            set log_count [expr {[ig::log_stat -level W] + [ig::log_stat -level E]}]
+
+            if {($template_lang eq "icgt") || ($template_lang eq {})} {
+                set template_script [parse_template ${template_raw} ${template_filename}]
+            } elseif {($template_lang eq "wtf")} {
+                set template_script [parse_wtf ${template_raw} ${template_filename}]
+            } else {
+                ig::log -error -abort "invalid template language ${template_lang}"
+            }
+
+            # templates with parser warnings are not cached to keep messages and exit code of later runs
+            if {[expr {[ig::log_stat -level W] + [ig::log_stat -level E]}] == $log_count} {
+                template_cache_write $fname_full $template_lang $template_raw $template_includes $template_script
+            }
         }
 
-        lappend template_script_cache [list $fname_full $template_script]
+        dict set template_script_cache $fname_full $template_script
+        template_stats_add $fname_full "parse" [expr {[clock microseconds] - $t_start}]
 
         return $template_script
     }
 
+    ## @brief Set directory for persistent cache of parsed template scripts.
+    # @param dir Cache directory or empty to disable persistent caching.
+    proc set_template_cache_dir {dir} {
+        variable template_cache_dir
+
+        if {$dir ne {}} {
+            set dir [file normalize $dir]
+        }
+        set template_cache_dir $dir
+    }
+
+    ## @brief Content hash for persistent template cache and output manifests.
+    # @param content File content or other string data.
+    # @return Hash string.
+    proc content_hash {content} {
+        set data [encoding convertto utf-8 $content]
+        return [format "%d-%08x-%08x" [string length $data] [zlib crc32 $data] [zlib adler32 $data]]
+    }
+
+    ## @brief Cache file of template in persistent template cache.
+    # @param fname_full Normalized path of template file.
+    # @return Path of cache file.
+    proc template_cache_file {fname_full} {
+        variable template_cache_dir
+
+        return [file join $template_cache_dir [format "%s-%08x.tcl" [file tail $fname_full] [zlib crc32 [encoding convertto utf-8 $fname_full]]]]
+    }
+
+    ## @brief Lookup parsed template script in persistent template cache.
+    # @param fname_full Normalized path of template file.
+    # @param template_lang Template language.
+    # @param template_raw Content of template file.
+    # @return Cached template script or empty if not cached or outdated.
+    #
+    # A cache entry is valid if template file and all included files
+    # have the same modification time and content hash as when parsed.
+    proc template_cache_read {fname_full template_lang template_raw} {
+        variable template_cache_dir
+        variable template_cache_parser
+
+        if {$template_cache_dir eq {}} {
+            return {}
+        }
+
+        set cachefile [template_cache_file $fname_full]
+        if {![file isfile $cachefile]} {
+            return {}
+        }
+
+        if {[catch {
+            set f [open $cachefile "r"]
+            fconfigure $f -encoding utf-8
+            set entry [read $f]
+            close $f
+
+            foreach key {parser lang file deps script} {
+                set $key [dict get $entry $key]
+            }
+        } msg]} {
+            ig::log -debug -id TCach "ignoring invalid template cache file ${cachefile}: ${msg}"
+            return {}
+        }
+
+        if {($parser ne $template_cache_parser) || ($lang ne $template_lang) || ($file ne $fname_full)} {
+            return {}
+        }
+
+        foreach dep $deps {
+            lassign $dep dep_file dep_mtime dep_hash
+
+            if {[catch {file mtime $dep_file} mtime] || ($mtime != $dep_mtime)} {
+                return {}
+            }
+            if {$dep_file eq $fname_full} {
+                set content $template_raw
+            } elseif {[catch {
+                set f [open $dep_file "r"]
+                set content [read $f]
+                close $f
+            }]} {
+                return {}
+            }
+            if {[content_hash $content] ne $dep_hash} {
+                return {}
+            }
+        }
+
+        ig::log -debug -id TCach "using cached template script for ${fname_full}"
+        return $script
+    }
+
+    ## @brief Store parsed template script in persistent template cache.
+    # @param fname_full Normalized path of template file.
+    # @param template_lang Template language.
+    # @param template_raw Content of template file.
+    # @param includes Files included by template.
+    # @param template_script Parsed template script.
+    proc template_cache_write {fname_full template_lang template_raw includes template_script} {
+        variable template_cache_dir
+        variable template_cache_parser
+
+        if {$template_cache_dir eq {}} {
+            return
+        }
+
+        if {[catch {
+            set deps [list [list $fname_full [file mtime $fname_full] [content_hash $template_raw]]]
+            foreach incfname [lsort -unique $includes] {
+                set f [open $incfname "r"]
+                set content [read $f]
+                close $f
+                lappend deps [list [file normalize $incfname] [file mtime $incfname] [content_hash $content]]
+            }
+
+            set entry [dict create \
+                "parser" $template_cache_parser \
+                "lang"   $template_lang \
+                "file"   $fname_full \
+                "deps"   $deps \
+                "script" $template_script \
+            ]
+
+            # write to temporary file and rename for concurrent runs
+            file mkdir $template_cache_dir
+            set cachefile [template_cache_file $fname_full]
+            set tmpfile "${cachefile}.[pid].tmp"
+            set f [open $tmpfile "w"]
+            fconfigure $f -encoding utf-8
+            puts -nonewline $f $entry
+            close $f
+            file rename -force $tmpfile $cachefile
+        } msg]} {
+            ig::log -debug -id TCach "failed to write template cache for ${fname_full}: ${msg}"
+            catch {file delete $tmpfile}
+        }
+    }
+
+    ## @brief Add timing of template parse or run to template statistics.
+    # @param template Normalized path of template file.
+    # @param type "parse" or "run".
+    # @param usecs Time in microseconds.
+    proc template_stats_add {template type usecs} {
+        variable template_stats
+
+        if {![dict exists $template_stats $template]} {
+            dict set template_stats $template [dict create "parse" 0 "runs" 0 "first" 0 "total" 0]
+        }
+
+        if {$type eq "parse"} {
+            dict set template_stats $template "parse" $usecs
+        } else {
+            if {[dict get $template_stats $template "runs"] == 0} {
+                dict set template_stats $template "first" $usecs
+            }
+            dict with template_stats $template {
+                incr runs
+                incr total $usecs
+            }
+        }
+    }
+
+    ## @brief Merge template timing statistics of another process (e.g. a worker of @ref generate_parallel).
+    # @param stats Template statistics in the form of template_stats.
+    #
+    # Parse times, runs and total run times are added, the first run is kept if already recorded.
+    proc template_stats_merge {stats} {
+        variable template_stats
+
+        dict for {template tstats} $stats {
+            if {![dict exists $template_stats $template] || ([dict get $template_stats $template "runs"] == 0)} {
+                set first [dict get $tstats "first"]
+            } else {
+                set first [dict get $template_stats $template "first"]
+            }
+            foreach key {"parse" "runs" "total"} {
+                if {[dict exists $template_stats $template $key]} {
+                    dict set tstats $key [expr {[dict get $tstats $key] + [dict get $template_stats $template $key]}]
+                }
+            }
+            dict set tstats "first" $first
+            dict set template_stats $template $tstats
+        }
+    }
+
+    ## @brief Log timing statistics of templates used so far (debug messages with id TStat).
+    #
+    # Parse time covers template to Tcl translation, the first run additionally includes bytecode compilation.
+    proc log_template_stats {} {
+        variable template_stats
+
+        dict for {template stats} $template_stats {
+            dict with stats {
+                set avg [expr {$runs > 1 ? ($total - $first) / ($runs - 1) : $first}]
+                ig::log -debug -id TStat [format "%s: parse %.2f ms, %d run(s), first run %.2f ms, later runs %.2f ms avg, total %.2f ms" \
+                    $template [expr {$parse / 1000.0}] $runs [expr {$first / 1000.0}] [expr {$avg / 1000.0}] [expr {($parse + $total) / 1000.0}]]
+            }
+        }
+    }
+
+    ## @brief Enable/disable skipping of output files with unchanged content.
+    # @param enable If true, existing output files are only replaced if their content changed.
+    proc set_skip_unchanged {enable} {
+        variable output_skip_unchanged
+        set output_skip_unchanged $enable
+    }
+
+    ## @brief Enable/disable incremental generation.
+    # @param enable If true, outputs are only generated if their inputs changed since the last run.
+    #
+    # Inputs of an output and a hash of the generated file are recorded in a manifest
+    # in the output directory (see @ref output_manifest_file).
+    proc set_incremental {enable} {
+        variable output_incremental
+        set output_incremental $enable
+    }
+
+    ## @brief Check whether output files can be left unchanged.
+    # @return true if @ref set_skip_unchanged or @ref set_incremental is enabled.
+    proc output_skipping_enabled {} {
+        variable output_skip_unchanged
+        variable output_incremental
+        return [expr {$output_skip_unchanged || $output_incremental}]
+    }
+
+    ## @brief Manifest file for outputs in a directory.
+    # @param dir Output directory.
+    # @return Path of manifest file.
+    proc output_manifest_file {dir} {
+        return [file join $dir ".icglue-manifest"]
+    }
+
+    ## @brief Lookup manifest entry of output file.
+    # @param outf_name Output file.
+    # @return List of input hash and output hash or empty if not recorded.
+    proc output_manifest_get {outf_name} {
+        variable output_manifests
+
+        set dir [file normalize [file dirname $outf_name]]
+        if {![dict exists $output_manifests $dir]} {
+            set manifest [dict create]
+            set mfile [output_manifest_file $dir]
+            if {[file isfile $mfile]} {
+                if {[catch {
+                    set f [open $mfile "r"]
+                    fconfigure $f -encoding utf-8
+                    set manifest [read $f]
+                    close $f
+                    dict size $manifest
+                } msg]} {
+                    ig::log -debug -id TMan "ignoring invalid output manifest ${mfile}: ${msg}"
+                    set manifest [dict create]
+                }
+            }
+            dict set output_manifests $dir $manifest
+        }
+
+        set tail [file tail $outf_name]
+        if {[dict exists $output_manifests $dir $tail]} {
+            return [dict get $output_manifests $dir $tail]
+        }
+        return {}
+    }
+
+    ## @brief Record manifest entry of output file.
+    # @param outf_name Output file.
+    # @param entry List of input hash and output hash.
+    proc output_manifest_set {outf_name entry} {
+        variable output_manifests
+        variable output_manifest_updates
+
+        # load existing manifest before updating
+        output_manifest_get $outf_name
+
+        set dir  [file normalize [file dirname $outf_name]]
+        set tail [file tail $outf_name]
+        dict set output_manifests        $dir $tail $entry
+        dict set output_manifest_updates $dir $tail $entry
+    }
+
+    ## @brief Get manifest entries updated in this run.
+    # @return dict of directory -> dict of file -> manifest entry.
+    proc get_output_manifest_updates {} {
+        variable output_manifest_updates
+        return $output_manifest_updates
+    }
+
+    ## @brief Write output manifests updated in this run.
+    proc write_output_manifests {} {
+        variable output_manifests
+        variable output_manifest_updates
+
+        foreach dir [dict keys $output_manifest_updates] {
+            set mfile [output_manifest_file $dir]
+            set tmpfile "${mfile}.[pid].tmp"
+            if {[catch {
+                set f [open $tmpfile "w"]
+                fconfigure $f -encoding utf-8
+                dict for {tail entry} [dict get $output_manifests $dir] {
+                    puts $f [list $tail $entry]
+                }
+                close $f
+                file rename -force -- $tmpfile $mfile
+            } msg]} {
+                ig::log -warn -id TMan "failed to write output manifest ${mfile}: ${msg}"
+                catch {file delete -- $tmpfile}
+            }
+        }
+        set output_manifest_updates [dict create]
+    }
+
+    ## @brief Hash of file content.
+    # @param fname Path to file.
+    # @return Hash string as returned by @ref content_hash.
+    proc file_hash {fname} {
+        set f [open $fname "rb"]
+        set data [read $f]
+        close $f
+        return [format "%d-%08x-%08x" [string length $data] [zlib crc32 $data] [zlib adler32 $data]]
+    }
+
+    ## @brief Fingerprint of template used for incremental generation.
+    # @param template_name Path to template file.
+    # @param template_lang Template language.
+    # @return Hash of parsed template script (including included templates) and Tcl files of template set.
+    proc template_fingerprint {template_name template_lang} {
+        variable template_fingerprints
+        variable template_cache_parser
+
+        set fname_full [file normalize $template_name]
+        if {![dict exists $template_fingerprints $fname_full]} {
+            set data [list $template_cache_parser [get_template_script $template_name $template_lang]]
+            foreach tclfile [lsort [glob -nocomplain -directory $current::template_dir "*.tcl" "*/*.tcl"]] {
+                lappend data [file_hash $tclfile]
+            }
+            dict set template_fingerprints $fname_full [content_hash $data]
+        }
+
+        return [dict get $template_fingerprints $fname_full]
+    }
+
+    ## @brief Fingerprint of object data used for incremental generation.
+    # @param obj_id Object-ID of module or regfile.
+    # @return Hash of attributes of object and objects it contains.
+    #
+    # For modules, this covers ports, parameters, declarations, codesections,
+    # regfiles and instances with their pins, adjustments and instanciated module interface.
+    # For regfiles, this covers entries, registers and the attributes of the parent module.
+    proc object_fingerprint {obj_id} {
+        set data [list [ig::db::get_attribute -object $obj_id]]
+
+        set type [ig::db::get_attribute -object $obj_id -attribute "type"]
+        if {$type eq "module"} {
+            foreach i_obj [concat \
+                    [ig::db::get_ports        -of $obj_id] \
+                    [ig::db::get_parameters   -of $obj_id] \
+                    [ig::db::get_declarations -of $obj_id] \
+                    [ig::db::get_codesections -of $obj_id]] {
+                lappend data [ig::db::get_attribute -object $i_obj]
+            }
+            foreach i_inst [ig::db::get_instances -of $obj_id] {
+                set i_mod [ig::db::get_modules -of $i_inst]
+                foreach i_obj [concat \
+                        [list $i_inst] \
+                        [ig::db::get_pins        -of $i_inst] \
+                        [ig::db::get_adjustments -of $i_inst] \
+                        [list $i_mod] \
+                        [ig::db::get_ports       -of $i_mod] \
+                        [ig::db::get_parameters  -of $i_mod]] {
+                    lappend data [ig::db::get_attribute -object $i_obj]
+                }
+            }
+            foreach i_regfile [ig::db::get_regfiles -of $obj_id] {
+                lappend data [object_fingerprint $i_regfile]
+            }
+        } elseif {$type eq "regfile"} {
+            # regfile outputs depend on parent module (e.g. language, parentunit)
+            lappend data [ig::db::get_attribute -object [ig::db::get_attribute -object $obj_id -attribute "parent"]]
+            foreach i_entry [ig::db::get_regfile_entries -of $obj_id] {
+                lappend data [ig::db::get_attribute -object $i_entry]
+                foreach i_reg [ig::db::get_regfile_regs -of $i_entry] {
+                    lappend data [ig::db::get_attribute -object $i_reg]
+                }
+            }
+        }
+
+        return [content_hash $data]
+    }
+
+    ## @brief Reset output statistics.
+    proc reset_output_stats {} {
+        variable output_stats
+        set output_stats [dict create "written" 0 "unchanged" 0]
+    }
+
+    ## @brief Get output statistics.
+    # @return dict with number of "written" and "unchanged" output files.
+    proc get_output_stats {} {
+        variable output_stats
+        return $output_stats
+    }
+
+    ## @brief Compare content of two files.
+    # @param fname1 Path to first file.
+    # @param fname2 Path to second file.
+    # @return true if both files have identical content.
+    proc file_content_equal {fname1 fname2} {
+        if {[file size $fname1] != [file size $fname2]} {
+            return "false"
+        }
+
+        set f1 [open $fname1 "rb"]
+        set f2 [open $fname2 "rb"]
+        set equal "true"
+        while {![eof $f1]} {
+            if {[read $f1 65536] ne [read $f2 65536]} {
+                set equal "false"
+                break
+            }
+        }
+        close $f1
+        close $f2
+
+        return $equal
+    }
+
+    ## @brief Run output generation for a list of items in parallel worker processes.
+    # @param jobs Number of worker processes.
+    # @param items List of items to process.
+    # @param cmdprefix Command prefix called with each item as additional argument.
+    #
+    # Workers are forked after the database has been constructed and work on their own copy of it,
+    # so @c cmdprefix must not modify the database in a way that other items depend on.
+    # Log output is collected per item and printed in the order of @c items after all workers finished.
+    # Log, output and template statistics of the workers are merged into the statistics of the calling process.
+    # Items of workers that could not be started are processed by the calling process.
+    proc generate_parallel {jobs items cmdprefix} {
+        variable output_stats
+
+        set jobs [expr {min($jobs, [llength $items])}]
+        if {$jobs <= 1} {
+            foreach i_item $items {
+                {*}$cmdprefix $i_item
+            }
+            return
+        }
+
+        if {[info exists ::env(TMPDIR)]} {
+            set tmpdir $::env(TMPDIR)
+        } else {
+            set tmpdir "/tmp"
+        }
+        set tmpdir [ig::sys::mkdtemp -prefix [file join $tmpdir "icglue-"]]
+
+        set log_base [dict create "print" [ig::log_stat] "suppress" [ig::log_stat -suppress]]
+
+        set pids {}
+        for {set i_worker 0} {$i_worker < $jobs} {incr i_worker} {
+            if {[catch {ig::sys::fork} pid]} {
+                ig::log -error -id Gen "could not start worker process (${pid}), generating remaining outputs in main process"
+                break
+            }
+            if {$pid == 0} {
+                set exitcode 0
+                if {[catch {generate_parallel_worker $i_worker $jobs $items $cmdprefix $tmpdir $log_base}]} {
+                    set exitcode 1
+                }
+                exit $exitcode
+            }
+            lappend pids $pid
+        }
+        set started [llength $pids]
+
+        # wait for started workers and collect their results, temporary directory is removed in any case
+        set collect_status [catch {
+            set workers_ok {}
+            foreach pid $pids {
+                lappend workers_ok [expr {[ig::sys::waitpid -pid $pid] == 0}]
+            }
+
+            # print collected log output in item order
+            set stderr_translation [fconfigure stderr -translation]
+            fconfigure stderr -translation binary
+            for {set i_item 0} {$i_item < [llength $items]} {incr i_item} {
+                set logfile [file join $tmpdir "item-${i_item}.log"]
+                if {[file exists $logfile]} {
+                    set f [open $logfile "rb"]
+                    fcopy $f stderr
+                    close $f
+                }
+            }
+            fconfigure stderr -translation $stderr_translation
+
+            # merge statistics
+            for {set i_worker 0} {$i_worker < $started} {incr i_worker} {
+                set statfile [file join $tmpdir "worker-${i_worker}.stat"]
+                if {![lindex $workers_ok $i_worker] || ![file exists $statfile]} {
+                    ig::log -error -id Gen "worker process [lindex $pids $i_worker] failed"
+                    continue
+                }
+                set f [open $statfile "r"]
+                set stats [read $f]
+                close $f
+
+                foreach {type opt} {"print" {} "suppress" "-suppress"} {
+                    foreach {level count} [dict get $stats $type] {
+                        if {$count > 0} {
+                            ig::log_stat -level $level {*}$opt -add $count
+                        }
+                    }
+                }
+                dict for {key count} [dict get $stats "output"] {
+                    dict incr output_stats $key $count
+                }
+                template_stats_merge [dict get $stats "templates"]
+                dict for {dir entries} [dict get $stats "manifest"] {
+                    dict for {tail entry} $entries {
+                        output_manifest_set [file join $dir $tail] $entry
+                    }
+                }
+            }
+        } collect_result collect_options]
+        file delete -force -- $tmpdir
+        if {$collect_status} {
+            return -options $collect_options $collect_result
+        }
+
+        # items of workers that could not be started
+        for {set i_worker $started} {$i_worker < $jobs} {incr i_worker} {
+            for {set i_item $i_worker} {$i_item < [llength $items]} {incr i_item $jobs} {
+                {*}$cmdprefix [lindex $items $i_item]
+            }
+        }
+    }
+
+    ## @brief Worker process of @ref generate_parallel.
+    # @param worker Index of worker.
+    # @param jobs Number of workers.
+    # @param items List of all items.
+    # @param cmdprefix Command prefix called with each item as additional argument.
+    # @param tmpdir Directory for log output and statistics.
+    # @param log_base Log statistics at time of fork.
+    proc generate_parallel_worker {worker jobs items cmdprefix tmpdir log_base} {
+        variable output_stats
+        variable template_stats
+        reset_output_stats
+        set template_stats [dict create]
+
+        for {set i_item $worker} {$i_item < [llength $items]} {incr i_item $jobs} {
+            ig::sys::redirect_stderr -file [file join $tmpdir "item-${i_item}.log"]
+            if {[catch {{*}$cmdprefix [lindex $items $i_item]}]} {
+                ig::log -error -id Gen "Error while generating output\nstacktrace:\n${::errorInfo}"
+            }
+        }
+
+        set stats [dict create "output" $output_stats "manifest" [get_output_manifest_updates] "templates" $template_stats]
+        foreach {type opt} {"print" {} "suppress" "-suppress"} {
+            set counts {}
+            foreach {level count} [ig::log_stat {*}$opt] {
+                lappend counts $level [expr {$count - [dict get $log_base $type $level]}]
+            }
+            dict set stats $type $counts
+        }
+
+        set statfile [file join $tmpdir "worker-${worker}.stat"]
+        set f [open "${statfile}.tmp" "w"]
+        puts -nonewline $f $stats
+        close $f
+        file rename -- "${statfile}.tmp" $statfile
+    }
+
+    ## @brief Create namespace for running templates if not yet existing.
+    #
+    # The namespace is kept across template outputs, so cached template scripts
+    # are compiled to bytecode only once.
+    proc template_run_init {} {
+        if {[namespace exists _template_run]} {
+            return
+        }
+
+        namespace eval _template_run {
+            namespace import ::ig::aux::*
+            namespace import ::ig::templates::preprocess::*
+            namespace import ::ig::templates::get_keep_block_content
+            namespace import ::ig::templates::pop_keep_block_content
+            namespace import ::ig::templates::remaining_keep_block_contents
+            namespace import ::ig::log
+
+            proc echo {args} {
+                variable _res_var
+                variable _res_count
+                append _res_var {*}$args
+                if {[incr _res_count] >= 1024} {
+                    ::ig::templates::template_run_flush
+                }
+            }
+            proc _filename {f} {
+                variable _filename_var
+                set _filename_var $f
+            }
+            proc _linenr {n} {
+                variable _linenr_var
+                set _linenr_var $n
+            }
+        }
+        template_run_clear
+    }
+
+    ## @brief Reset template namespace to its initial state.
+    #
+    # Removes all variables and procs defined by the last template run.
+    proc template_run_clear {} {
+        foreach v [info vars _template_run::*] {
+            unset -nocomplain $v
+        }
+        foreach p [info procs _template_run::*] {
+            set p [namespace which -command $p]
+            # keep imported and base procs
+            if {([namespace origin $p] eq $p) && ([namespace tail $p] ni {echo _filename _linenr})} {
+                rename $p {}
+            }
+        }
+
+        set _template_run::_res_var      {}
+        set _template_run::_res_count    0
+        set _template_run::_res_chan     {}
+        set _template_run::_linenr_var   0
+        set _template_run::_filename_var {}
+    }
+
+    ## @brief Write accumulated template output to the current output channel.
+    #
+    # Called periodically by echo, so that template output is streamed to the
+    # output file instead of being kept in memory as a whole.
+    # Without output channel (dry run) the output is discarded.
+    proc template_run_flush {} {
+        if {${_template_run::_res_chan} ne {}} {
+            puts -nonewline ${_template_run::_res_chan} ${_template_run::_res_var}
+        }
+        set _template_run::_res_var   {}
+        set _template_run::_res_count 0
+    }
+
+    ## @brief Get file to be replaced when writing an output file.
+    # @param outf_name output file name
+    # @return outf_name or final target if outf_name is a symbolic link
+    proc output_target {outf_name} {
+        while {[file type $outf_name] eq "link"} {
+            set outf_name [file join [file dirname $outf_name] [file readlink $outf_name]]
+        }
+        return $outf_name
+    }
+
     ## @brief Generate output-file based on template and provided data.
     # @param outf_name Output file name to generate / read in for keep-blocks.
     # @param template_name name of template file.
@@ -1220,9 +1621,12 @@ namespace eval ig::templates {
     # @param lognote note text to print in error log messages for reference.
     # @param dryrun If set to true, no actual files are written.
     # @param lexcom lexer token for comment as list - e.g {"/* " " */"}
+    # @param input_hash hash of inputs for incremental generation (see @ref set_incremental) or empty.
     #
     # The output is written to the file specified by the template callback @ref ig::templates::current::get_template_data_raw.
-    proc generate_template_output {outf_name template_name template_lang template_data lognote dryrun lexcom} {
+    # If @c input_hash is given and matches the output manifest together with the existing output file,
+    # the output is considered up to date and not generated.
+    proc generate_template_output {outf_name template_name template_lang template_data lognote dryrun lexcom {input_hash {}}} {
         if {!$dryrun} {
             file mkdir [file dirname $outf_name]
         }
@@ -1250,7 +1654,18 @@ namespace eval ig::templates {
         }
 
         #actual template
-        set block_data [list]
+        variable output_stats
+
+        if {($input_hash ne {}) && !$dryrun && [file isfile $outf_name]} {
+            lassign [output_manifest_get $outf_name] m_input m_output
+            if {($m_input eq $input_hash) && ([file_hash $outf_name] eq $m_output)} {
+                dict incr output_stats "unchanged"
+                ig::log -debug -id Gen "${outf_name} is up to date"
+                return
+            }
+        }
+
+        set block_data [dict create]
         if {[file exists $outf_name] && $lexcom ne {}} {
             set outf [open $outf_name "r"]
             set oldcontent [read $outf]
@@ -1260,64 +1675,74 @@ namespace eval ig::templates {
 
         set template_code [get_template_script $template_name $template_lang]
 
-        set template_data_preset "\n"
+        # output is streamed to a temporary file next to the target and renamed on success
+        set tmpf_name {}
+        set tmpf      {}
+        if {!$dryrun} {
+            set outf_target $outf_name
+            if {[file exists $outf_name]} {
+                set outf_target [output_target $outf_name]
+            }
+            set tmpf_name "${outf_target}.icglue-[pid].tmp"
+            set tmpf [open $tmpf_name "w"]
+        }
+
+        # evaluate result in persistent namespace: the cached script object keeps its bytecode across outputs
+        template_run_init
+        set _template_run::keep_block_data $block_data
+        set _template_run::lexcom          $lexcom
+        set _template_run::_res_chan       $tmpf
         foreach {key value} $template_data {
-            append template_data_preset "    variable [list $key] [list $value]\n"
-        }
-
-        # evaluate result in temporary namespace
-        eval [join [list \
-            "namespace eval _template_run \{" \
-            {    namespace import ::ig::aux::*} \
-            {    namespace import ::ig::templates::preprocess::*} \
-            {    namespace import ::ig::templates::get_keep_block_content} \
-            {    namespace import ::ig::templates::pop_keep_block_content} \
-            {    namespace import ::ig::templates::remaining_keep_block_contents} \
-            {    namespace import ::ig::log} \
-            "    variable keep_block_data [list $block_data]" \
-            "    variable lexcom [list $lexcom]" \
-            {    variable _res_var {}} \
-            {    variable _linenr_var 0} \
-            {    variable _filename_var {}} \
-            {    variable _error_var {}} \
-            "    proc echo {args} \{" \
-            {        variable _res_var} \
-            {        append _res_var {*}$args} \
-            "    \}" \
-            "    proc _filename {f} \{" \
-            {        variable _filename_var} \
-            {        set _filename_var $f} \
-            "    \}" \
-            "    proc _linenr {n} \{" \
-            {        variable _linenr_var} \
-            {        set _linenr_var $n} \
-            "    \}" \
-            $template_data_preset \
-            "    if {\[catch {" \
-            "        eval [list $template_code]" \
-            "        } _errorres\]} {" \
-            {        set _error_var $_errorres} \
-            "    }" \
-            "\}" \
-            ] "\n"]
-
-        set res      ${_template_run::_res_var}
-        set error    ${_template_run::_error_var}
+            set _template_run::${key} $value
+        }
+
+        set error {}
+        set t_start [clock microseconds]
+        if {[catch {
+            namespace eval _template_run $template_code
+            template_run_flush
+        } errorres]} {
+            set error $errorres
+        }
+        template_stats_add [file normalize $template_name] "run" [expr {[clock microseconds] - $t_start}]
+
         set linenr   ${_template_run::_linenr_var}
         set filename ${_template_run::_filename_var}
-        namespace delete _template_run
+        template_run_clear
+
+        if {$tmpf ne {}} {
+            if {[catch {close $tmpf} errorres] && ($error eq "")} {
+                set error $errorres
+            }
+        }
 
         if {$error ne ""} {
+            if {$tmpf_name ne {}} {
+                file delete -- $tmpf_name
+            }
             ig::log -error "Error while running template ${lognote}\nstacktrace:\n${::errorInfo}"
             ig::log -error "template ${filename} somewhere after line ${linenr}"
             return
         }
 
         if {!$dryrun} {
-            file mkdir [file dirname $outf_name]
-            set outf [open $outf_name "w"]
-            puts -nonewline $outf $res
-            close $outf
+            variable output_skip_unchanged
+
+            if {$input_hash ne {}} {
+                output_manifest_set $outf_name [list $input_hash [file_hash $tmpf_name]]
+            }
+
+            if {[file exists $outf_target]} {
+                if {$output_skip_unchanged && [file_content_equal $tmpf_name $outf_target]} {
+                    file delete -- $tmpf_name
+                    dict incr output_stats "unchanged"
+                    ig::log -debug -id Gen "Content of ${outf_name} unchanged"
+                    return
+                }
+                catch {file attributes $tmpf_name -permissions [file attributes $outf_target -permissions]}
+            }
+            file rename -force -- $tmpf_name $outf_target
+            dict incr output_stats "written"
         }
     }
 
@@ -1446,6 +1871,9 @@ namespace eval ig::templates {
 
         set tt_data [list "obj_id" $obj_id]
 
+        variable output_incremental
+        set obj_fingerprint {}
+
         set obj_outtypes [process_outtypelist [split [ig::db::get_attribute -object $obj_id -attribute "outtypes" -default {}] ,]]
 
         foreach {pfx tag lang ttfile outfile lexcom} $tdata {
@@ -1459,7 +1887,15 @@ namespace eval ig::templates {
 
             set tt_note "type ${tag} / object [ig::db::get_attribute -object ${obj_id} -attribute "name"]"
 
-            generate_template_output $outfile $ttfile $lang $tt_data $tt_note $dryrun $lexcom
+            set input_hash {}
+            if {$output_incremental && !$dryrun && ($lang ni {"link!" "copy!" "link" "copy"})} {
+                if {$obj_fingerprint eq {}} {
+                    set obj_fingerprint [object_fingerprint $obj_id]
+                }
+                set input_hash [content_hash [list $obj_fingerprint [template_fingerprint $ttfile $lang] $tag $lang $lexcom]]
+            }
+
+            generate_template_output $outfile $ttfile $lang $tt_data $tt_note $dryrun $lexcom $input_hash
         }
     }
 
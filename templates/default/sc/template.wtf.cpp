@@ -19,9 +19,8 @@
     set initializers [join $initializers ",\n    "]
     set init_keep_block_name "sc_module(${mod_data(name)})_intialize"
     if {$initializers ne ""} {
-        set idx [lsearch -index 1 $keep_block_data "$init_keep_block_name"]
-        if {($idx >= 0)} {
-            set keep_block_content [lindex $keep_block_data $idx 2]
+        if {[dict exists $keep_block_data [list "keep" $init_keep_block_name]]} {
+            set keep_block_content [lindex [dict get $keep_block_data [list "keep" $init_keep_block_name]] 0 1]
             set no_ws_keep_block_content [string map {" " "" "\n" "" "\t" ""} $keep_block_content]
             if {$no_ws_keep_block_content ne ""} {
                 append initializers ","
@@ -0,0 +1,19 @@
+# test files
+deploy mod.icglue           units/mod/source/gen/
+
+# setup
+run icprep project
+
+# create signals in one batch, failing specifications do not affect the others
+run_nocheck icglue -o vlog-v units/mod/source/gen/mod.icglue
+
+eval_run_output {
+    exact {BATCH ok sig_a 4}                                                        1
+    exact {BATCH ok sig_b 1}                                                        1
+    exact {BATCH error Signal "sig_a": signal specified more than once}             1
+    glob  {BATCH error * could not find object}                                     1
+    glob  {BATCH error * -from is required for unidirectional signals}              1
+    exact {E,LConB     signal sig_a: signal specified more than once}               1
+    glob  {E,TCCon * could not find object for id "nosuch"}                         1
+    glob  {E,* *}                                                                   2
+}
@@ -0,0 +1,23 @@
+# test files
+deploy mod.icglue           units/mod/source/gen/
+
+# setup
+run icprep project
+
+# expand instance expressions
+run icglue -o \* units/mod/source/gen/mod.icglue
+
+eval_run_output {
+    exact {EXPAND core<> = }                                                                            1
+    exact {EXPAND core<>:sig = }                                                                        1
+    exact {EXPAND core = {core core {} {}}}                                                             1
+    exact {EXPAND ~core:sig = {core core :sig ~}}                                                       1
+    exact {EXPAND core<0..2>:sig = {core_0 core :sig {}} {core_1 core :sig {}} {core_2 core :sig {}}}   1
+    exact {EXPAND core<a,b> = {core_a core {} {}} {core_b core {} {}}}                                  1
+    exact {EXPAND core<01..3x> = {core_01x core {} {}} {core_2x core {} {}} {core_3x core {} {}}}       1
+    exact {EXPAND core<x0..1y1..2> = {core_x0y1 core {} {}} {core_x0y2 core {} {}} {core_x1y1 core {} {}} {core_x1y2 core {} {}}} 1
+    exact {EXPAND-IDS core<>:sig = }                                                                    1
+    exact {EXPAND-IDS core<1>:sig = 1}                                                                  1
+    glob  {W,* *} 0
+    glob  {E,* *} 0
+}
@@ -0,0 +1,26 @@
+# test files
+deploy mod.icglue           units/mod/source/gen/
+
+# setup
+run icprep project
+
+# initial generation
+run icglue --incremental -o rf-tex units/mod/source/gen/mod.icglue
+eval_run_output {
+    glob {*Files:*1 written, 0 unchanged.} 1
+}
+
+# unchanged inputs: output is up to date
+run icglue --incremental -o rf-tex units/mod/source/gen/mod.icglue
+eval_run_output {
+    glob {*Files:*0 written, 1 unchanged.} 1
+}
+
+# changed language of parent module: regfile output is regenerated
+run sed -i {s/(rtl,rf=mod)/(rtl,sv,rf=mod)/} units/mod/source/gen/mod.icglue
+run icglue --incremental -o rf-tex units/mod/source/gen/mod.icglue
+eval_run_output {
+    glob {*Files:*1 written, 0 unchanged.} 1
+    glob {W,* *} 0
+    glob {E,* *} 0
+}
@@ -0,0 +1,26 @@
+# test files
+deploy mod.icglue           units/mod/source/gen/
+
+# setup
+run icprep project
+
+# initial generation: no file summary without --skip-unchanged
+run icglue -o rf-tex units/mod/source/gen/mod.icglue
+eval_run_output {
+    glob {*Files:*} 0
+}
+
+# same content: existing output is kept
+run icglue --skip-unchanged -o rf-tex units/mod/source/gen/mod.icglue
+eval_run_output {
+    glob {*Files:*0 written, 1 unchanged.} 1
+}
+
+# changed regfile entry: output is rewritten
+run sed -i {s/"configuration"/"changed configuration"/} units/mod/source/gen/mod.icglue
+run icglue --skip-unchanged -o rf-tex units/mod/source/gen/mod.icglue
+eval_run_output {
+    glob {*Files:*1 written, 0 unchanged.} 1
+    glob {W,* *} 0
+    glob {E,* *} 0
+}
@@ -0,0 +1,26 @@
+# test files
+deploy mod.icglue           units/mod/source/gen/
+
+# setup
+run icprep project
+
+# outputs of all workers are generated, worker template statistics are merged
+run icglue -j 2 -l D,TStat units/mod/source/gen/mod.icglue
+eval_run_output {
+    glob {I,Gen *Generating*} 4
+    glob {D,TStat *template.wtf.v:*4 run(s)*} 1
+    glob {W,* *} 0
+    glob {E,* *} 0
+}
+
+# output statistics of workers are merged
+run icglue -j 2 --skip-unchanged units/mod/source/gen/mod.icglue
+eval_run_output {
+    glob {*Files:*0 written, 4 unchanged.} 1
+}
+
+# same output as single process generation
+run icglue --skip-unchanged units/mod/source/gen/mod.icglue
+eval_run_output {
+    glob {*Files:*0 written, 4 unchanged.} 1
+}
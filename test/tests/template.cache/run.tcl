@@ -0,0 +1,25 @@
+# test files
+deploy mod.icglue           units/mod/source/gen/
+
+# setup
+run icprep project
+
+# empty cache: templates are parsed and stored
+run icglue -v --template-cache=cache -l D,TCach units/mod/source/gen/mod.icglue
+eval_run_output {
+    glob {I,Gen *Generating*}            4
+    glob {I,WTFPr *parsing included*}    5
+    glob {D,TCach *using cached*}        0
+    glob {W,* *}                         0
+    glob {E,* *}                         0
+}
+
+# filled cache: parsed template is reused and generates the same output
+run icglue -v --template-cache=cache --skip-unchanged -l D,TCach units/mod/source/gen/mod.icglue
+eval_run_output {
+    glob {I,WTFPr *parsing included*}    0
+    glob {D,TCach *using cached*}        1
+    glob {*Files:*0 written, 4 unchanged.} 1
+    glob {W,* *}                         0
+    glob {E,* *}                         0
+}
@@ -0,0 +1,16 @@
+# test files
+deploy mod.icglue           units/mod/source/gen/
+
+# setup
+run icprep project
+
+run_nocheck icglue -o vlog-v units/mod/source/gen/mod.icglue
+# check for overlapping address, entry bits and driven signal bits warnings
+eval_run_output {
+    exact "W,ChkRA     regfile entries \"entry_hi\" and \"entry_dup\" overlap at address 0x00000004 (regfile mod_rf) (mod.icglue:24 \{R mod_rf \"entry_dup\" @0x4 \{ (...)\})" 1
+    exact "W,ChkRB     registers \"s_b\" and \"s_a\" in entry \"entry_dup\" overlap at bit 2 (regfile mod_rf) (mod.icglue:24 \{R mod_rf \"entry_dup\" @0x4 \{ (...)\})" 1
+    exact "W,ChkRB     registers \"s_b\" and \"s_a\" in entry \"entry_dup\" overlap at bit 3 (regfile mod_rf) (mod.icglue:24 \{R mod_rf \"entry_dup\" @0x4 \{ (...)\})" 1
+    exact "W,ChkRS     registers \"s_hi\" in entry \"entry_hi\" and \"s_lo\" in entry \"entry_lo\" drive overlapping bits of signal (cfg\[4\], regfile mod_rf) (mod.icglue:18 \{R mod_rf \"entry_hi\" \{ (...)\})" 1
+    glob  {W,* *} 4
+    glob  {E,* *} 0
+}